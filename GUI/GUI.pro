@@ -8,6 +8,28 @@ QT       += core gui
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
+CONFIG += c++11 thread
+
+# qmake CONFIG+=alsa to play the sound on ALSA devices
+alsa {
+    DEFINES += GBMU_ALSA
+    LIBS += -lasound
+}
+
+# qmake CONFIG+=zlib CONFIG+=lz4 CONFIG+=zstd for compressed save states
+zlib {
+    DEFINES += GBMU_ZLIB
+    LIBS += -lz
+}
+lz4 {
+    DEFINES += GBMU_LZ4
+    LIBS += -llz4
+}
+zstd {
+    DEFINES += GBMU_ZSTD
+    LIBS += -lzstd
+}
+
 TARGET = GUI
 TEMPLATE = app
 
@@ -20,6 +42,29 @@ SOURCES += main.cpp\
     ../srcs/Gb.cpp \
     ../srcs/Memory.cpp \
     ../srcs/Instructions.cpp \
+    ../srcs/Ppu.cpp \
+    ../srcs/Capture.cpp \
+    ../srcs/HashLog.cpp \
+    ../srcs/Scheduler.cpp \
+    ../srcs/Timer.cpp \
+    ../srcs/Interrupts.cpp \
+    ../srcs/Apu.cpp \
+    ../srcs/Blep.cpp \
+    ../srcs/Mixer.cpp \
+    ../srcs/WavSink.cpp \
+    ../srcs/AlsaSink.cpp \
+    ../srcs/AudioOutput.cpp \
+    ../srcs/FramePacer.cpp \
+    ../srcs/SaveState.cpp \
+    ../srcs/Rewind.cpp \
+    ../srcs/Joypad.cpp \
+    ../srcs/Movie.cpp \
+    ../srcs/Lockstep.cpp \
+    ../srcs/StateArena.cpp \
+    ../srcs/StateIndex.cpp \
+    ../srcs/ThreadPool.cpp \
+    ../srcs/StateCodec.cpp \
+    ../srcs/BootCache.cpp \
     mainwindow.cpp \
     hexspinbox.cpp
 
@@ -32,6 +77,33 @@ HEADERS  += \
     ../includes/Gbmu.class.hpp \
     ../includes/Memory.class.hpp \
     ../includes/Instructions.class.hpp \
+    ../includes/Ppu.class.hpp \
+    ../includes/IScreen.class.hpp \
+    ../includes/SpscRing.class.hpp \
+    ../includes/Capture.class.hpp \
+    ../includes/HashLog.class.hpp \
+    ../includes/Scheduler.class.hpp \
+    ../includes/Timer.class.hpp \
+    ../includes/Interrupts.class.hpp \
+    ../includes/Apu.class.hpp \
+    ../includes/Blep.class.hpp \
+    ../includes/Mixer.class.hpp \
+    ../includes/IAudioSink.class.hpp \
+    ../includes/WavSink.class.hpp \
+    ../includes/AlsaSink.class.hpp \
+    ../includes/AudioOutput.class.hpp \
+    ../includes/FramePacer.class.hpp \
+    ../includes/MpscQueue.class.hpp \
+    ../includes/SaveState.class.hpp \
+    ../includes/Rewind.class.hpp \
+    ../includes/Joypad.class.hpp \
+    ../includes/Movie.class.hpp \
+    ../includes/Lockstep.class.hpp \
+    ../includes/StateArena.class.hpp \
+    ../includes/StateIndex.class.hpp \
+    ../includes/ThreadPool.class.hpp \
+    ../includes/StateCodec.class.hpp \
+    ../includes/BootCache.class.hpp \
     mainwindow.h \
     hexspinbox.h
 
@@ -1,5 +1,6 @@
 #include "debugwindow.h"
 #include "ui_debugwindow.h"
+#include <chrono>
 
 /**
  * DebugWindow constructor
@@ -8,7 +9,11 @@
 DebugWindow::DebugWindow(QWidget *parent, Gbmu::Gb *gb) :
 	QMainWindow(parent),
 	_ui(new Ui::DebugWindow),
-	_gb(gb)
+	_gb(gb),
+	_poll(new QTimer(this)),
+	_seen(0),
+	_view(new Gbmu::Gb::Inspection),
+	_inspecting(false)
 {
 	_ui->setupUi(this); // load debugwindow.ui (Forms/debugwindow.ui)
 
@@ -51,8 +56,11 @@ DebugWindow::DebugWindow(QWidget *parent, Gbmu::Gb *gb) :
 	}
 
 	connect(_ui->actionStep, SIGNAL(triggered()), this, SLOT(_onStep()));
+	connect(_ui->actionExecute, SIGNAL(triggered()), this, SLOT(_onExecute()));
     // connect(_ui->inspectMemory, static_cast<void(QSpinBox::*)(const QString&)>(&QSpinBox::valueChanged), this, &DebugWindow::_onInspectMemory); // valueChanged overloaded so we have to make ugly casts
 	connect(_ui->inspectMemory, SIGNAL(editingFinished()), this, SLOT(_onInspectMemory()));
+	connect(_poll, SIGNAL(timeout()), this, SLOT(_onPoll()));
+	_poll->start(100); // never wait for the emulation thread, look at its status 10 times per second
 
 	updateUI(); // update UI once
 
@@ -65,13 +73,32 @@ DebugWindow::DebugWindow(QWidget *parent, Gbmu::Gb *gb) :
  */
 DebugWindow::~DebugWindow()
 {
+	if (_inspecting) // the emulation thread may still write it
+		while (!_view->ready.load())
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	delete _view;
 	delete _ui;
 }
 
 /**
- * Calls all UI related update functions (memory, registers, disassembler)
+ * Asks the emulation thread for a copy of the registers and the memory
+ * Shown at once without the thread, else by _onPoll once it is written
  */
 void DebugWindow::updateUI() {
+	if (_inspecting)
+		return;
+	_inspecting = true;
+	_gb->inspect(*_view);
+	if (_view->ready.load())
+		_showView();
+}
+
+/**
+ * Calls all UI related update functions (memory, registers, disassembler) on the last copy
+ */
+void DebugWindow::_showView() {
+	_inspecting = false;
+	_seen = _view->commands; // the copy itself is not something new
 	_updateRegisters();
 	_updateMemory();
 }
@@ -87,7 +114,7 @@ void DebugWindow::_updateMemory() {
 
 	for (int i = 0; i < _ui->memory->rowCount(); i++) {
 		for (int j = 0; j < 16; j++) {
-			byte = _gb->cpu()->memory()->getByteAt(i * 16 + j); // read byte from memory
+			byte = _view->memory[i * 16 + j]; // read byte from the copy
 			_ui->memory->item(i, j)->setData(Qt::DisplayRole, QString::number(byte, 16).rightJustified(2, '0')); // display read byte in the UI
 		}
 	}
@@ -98,17 +125,18 @@ void DebugWindow::_updateMemory() {
  * Values are not modified in this function
  */
 void DebugWindow::_updateRegisters() {
-	Gbmu::Registers * regs = _gb->cpu()->regs(); // get registers from attached gameboy
+	uint16_t const * regs = _view->registers; // copied from the attached gameboy
+	uint8_t const * mem = _view->memory; // I/O registers are read from memory
 
 	// TODO: Replace every 0xDEAD with the correct _reg->getXX()
 
 	// Update general registers
-    _ui->generalRegisters->item(DebugWindow::REG_PC, 0)->setData(Qt::DisplayRole, "0x" + QString::number(regs->getPC(), 16).toUpper());
-	_ui->generalRegisters->item(DebugWindow::REG_AF, 0)->setData(Qt::DisplayRole, "0x" + QString::number(regs->getAF(), 16).toUpper());
-	_ui->generalRegisters->item(DebugWindow::REG_BC, 0)->setData(Qt::DisplayRole, "0x" + QString::number(regs->getBC(), 16).toUpper());
-	_ui->generalRegisters->item(DebugWindow::REG_DE, 0)->setData(Qt::DisplayRole, "0x" + QString::number(regs->getDE(), 16).toUpper());
-	_ui->generalRegisters->item(DebugWindow::REG_HL, 0)->setData(Qt::DisplayRole, "0x" + QString::number(regs->getHL(), 16).toUpper());
-	//_ui->generalRegisters->item(DebugWindow::REG_SP, 0)->setData(Qt::DisplayRole, "0x" + QString::number(regs->getSP(), 16).toUpper());
+    _ui->generalRegisters->item(DebugWindow::REG_PC, 0)->setData(Qt::DisplayRole, "0x" + QString::number(regs[Gbmu::Gb::PC], 16).toUpper());
+	_ui->generalRegisters->item(DebugWindow::REG_AF, 0)->setData(Qt::DisplayRole, "0x" + QString::number(regs[Gbmu::Gb::AF], 16).toUpper());
+	_ui->generalRegisters->item(DebugWindow::REG_BC, 0)->setData(Qt::DisplayRole, "0x" + QString::number(regs[Gbmu::Gb::BC], 16).toUpper());
+	_ui->generalRegisters->item(DebugWindow::REG_DE, 0)->setData(Qt::DisplayRole, "0x" + QString::number(regs[Gbmu::Gb::DE], 16).toUpper());
+	_ui->generalRegisters->item(DebugWindow::REG_HL, 0)->setData(Qt::DisplayRole, "0x" + QString::number(regs[Gbmu::Gb::HL], 16).toUpper());
+	//_ui->generalRegisters->item(DebugWindow::REG_SP, 0)->setData(Qt::DisplayRole, "0x" + QString::number(regs[Gbmu::Gb::SP], 16).toUpper());
 
 	// Update video registers
 	_ui->videoRegisters->item(DebugWindow::REG_LCDC, 1)->setData(Qt::DisplayRole, "0xDEAD");
@@ -123,29 +151,29 @@ void DebugWindow::_updateRegisters() {
 	_ui->videoRegisters->item(DebugWindow::REG_OBP1, 1)->setData(Qt::DisplayRole, "0xDEAD");
 	_ui->videoRegisters->item(DebugWindow::REG_WY, 1)->setData(Qt::DisplayRole, "0xDEAD");
 	_ui->videoRegisters->item(DebugWindow::REG_WX, 1)->setData(Qt::DisplayRole, "0xDEAD");
-	_ui->videoRegisters->item(DebugWindow::REG_BCPS, 1)->setData(Qt::DisplayRole, "0xDEAD");
-	_ui->videoRegisters->item(DebugWindow::REG_BCPD, 1)->setData(Qt::DisplayRole, "0xDEAD");
-	_ui->videoRegisters->item(DebugWindow::REG_OCPS, 1)->setData(Qt::DisplayRole, "0xDEAD");
-	_ui->videoRegisters->item(DebugWindow::REG_OCPD, 1)->setData(Qt::DisplayRole, "0xDEAD");
+	_ui->videoRegisters->item(DebugWindow::REG_BCPS, 1)->setData(Qt::DisplayRole, "0x" + QString::number(mem[IO_BCPS], 16).toUpper());
+	_ui->videoRegisters->item(DebugWindow::REG_BCPD, 1)->setData(Qt::DisplayRole, "0x" + QString::number(mem[IO_BCPD], 16).toUpper());
+	_ui->videoRegisters->item(DebugWindow::REG_OCPS, 1)->setData(Qt::DisplayRole, "0x" + QString::number(mem[IO_OCPS], 16).toUpper());
+	_ui->videoRegisters->item(DebugWindow::REG_OCPD, 1)->setData(Qt::DisplayRole, "0x" + QString::number(mem[IO_OCPD], 16).toUpper());
 
 	// Update other registers
 	_ui->otherRegisters->item(DebugWindow::REG_P1, 1)->setData(Qt::DisplayRole, "0xDEAD");
 	_ui->otherRegisters->item(DebugWindow::REG_SB, 1)->setData(Qt::DisplayRole, "0xDEAD");
 	_ui->otherRegisters->item(DebugWindow::REG_SC, 1)->setData(Qt::DisplayRole, "0xDEAD");
-	_ui->otherRegisters->item(DebugWindow::REG_DIV, 1)->setData(Qt::DisplayRole, "0xDEAD");
-	_ui->otherRegisters->item(DebugWindow::REG_TIME, 1)->setData(Qt::DisplayRole, "0xDEAD");
-	_ui->otherRegisters->item(DebugWindow::REG_TMA, 1)->setData(Qt::DisplayRole, "0xDEAD");
-	_ui->otherRegisters->item(DebugWindow::REG_TAC, 1)->setData(Qt::DisplayRole, "0xDEAD");
+	_ui->otherRegisters->item(DebugWindow::REG_DIV, 1)->setData(Qt::DisplayRole, "0x" + QString::number(mem[IO_DIV], 16).toUpper());
+	_ui->otherRegisters->item(DebugWindow::REG_TIME, 1)->setData(Qt::DisplayRole, "0x" + QString::number(mem[IO_TIMA], 16).toUpper());
+	_ui->otherRegisters->item(DebugWindow::REG_TMA, 1)->setData(Qt::DisplayRole, "0x" + QString::number(mem[IO_TMA], 16).toUpper());
+	_ui->otherRegisters->item(DebugWindow::REG_TAC, 1)->setData(Qt::DisplayRole, "0x" + QString::number(mem[IO_TAC], 16).toUpper());
 	_ui->otherRegisters->item(DebugWindow::REG_KEY1, 1)->setData(Qt::DisplayRole, "0xDEAD");
-	_ui->otherRegisters->item(DebugWindow::REG_VBK, 1)->setData(Qt::DisplayRole, "0xDEAD");
+	_ui->otherRegisters->item(DebugWindow::REG_VBK, 1)->setData(Qt::DisplayRole, "0x" + QString::number(mem[IO_VBK], 16).toUpper());
 	_ui->otherRegisters->item(DebugWindow::REG_HDMA1, 1)->setData(Qt::DisplayRole, "0xDEAD");
 	_ui->otherRegisters->item(DebugWindow::REG_HDMA2, 1)->setData(Qt::DisplayRole, "0xDEAD");
 	_ui->otherRegisters->item(DebugWindow::REG_HDMA3, 1)->setData(Qt::DisplayRole, "0xDEAD");
 	_ui->otherRegisters->item(DebugWindow::REG_HDMA4, 1)->setData(Qt::DisplayRole, "0xDEAD");
 	_ui->otherRegisters->item(DebugWindow::REG_HDMA5, 1)->setData(Qt::DisplayRole, "0xDEAD");
 	_ui->otherRegisters->item(DebugWindow::REG_SVSK, 1)->setData(Qt::DisplayRole, "0xDEAD");
-	_ui->otherRegisters->item(DebugWindow::REG_IF, 1)->setData(Qt::DisplayRole, "0xDEAD");
-	_ui->otherRegisters->item(DebugWindow::REG_IE, 1)->setData(Qt::DisplayRole, "0xDEAD");
+	_ui->otherRegisters->item(DebugWindow::REG_IF, 1)->setData(Qt::DisplayRole, "0x" + QString::number(mem[IO_IF], 16).toUpper());
+	_ui->otherRegisters->item(DebugWindow::REG_IE, 1)->setData(Qt::DisplayRole, "0x" + QString::number(mem[IO_IE], 16).toUpper());
 }
 
 /**
@@ -180,21 +208,19 @@ void DebugWindow::_onGeneralRegisterChange(QTableWidgetItem *item) {
 
 	switch (item->row()) { // find which register was changed based on its row index
 	case DebugWindow::REG_AF:
-		_gb->cpu()->regs()->setAF(x); // set AF register
+		_gb->setRegister(Gbmu::Gb::AF, x); // set AF register
 		break;
 	case DebugWindow::REG_BC:
-		_gb->cpu()->regs()->setBC(x); // set BC register
+		_gb->setRegister(Gbmu::Gb::BC, x); // set BC register
 		break;
 	case DebugWindow::REG_DE:
-		_gb->cpu()->regs()->setDE(x); // set DE register
+		_gb->setRegister(Gbmu::Gb::DE, x); // set DE register
 		break;
 	case DebugWindow::REG_HL:
-		_gb->cpu()->regs()->setHL(x); // set HL register
+		_gb->setRegister(Gbmu::Gb::HL, x); // set HL register
 		break;
 	};
-	_disconnectSignals();
-	updateUI(); // refresh screen
-	_connectSignals();
+	// queued, the UI is refreshed by _onPoll once it is done
 }
 
 /**
@@ -211,17 +237,38 @@ void DebugWindow::_onMemoryChange(QTableWidgetItem *item) {
 	ss << std::hex << item->data(Qt::DisplayRole).toString().toStdString(); // get cell data (QVariant) to QString (toString) then to stdstring (toStdString)
 	ss >> byte; // get stringstream value as uint16_t
 	addr = item->row() * 16 + item->column(); // calculate addr based on row & column
-	_gb->cpu()->memory()->setByteAt(addr, static_cast<uint8_t>(byte)); // set byte at addr
-	_disconnectSignals();
-	updateUI(); // refresh screen
-	_connectSignals();
+	_gb->poke(addr, static_cast<uint8_t>(byte)); // set byte at addr, queued. The UI is refreshed by _onPoll once it is done
 }
 
 /**
  * Slot function called when step button is clicked
  */
 void DebugWindow::_onStep() {
-	_gb->cpu()->executeFrame();
+	_gb->runFor(1); // one instruction, the game stays paused. UI is refreshed by _onPoll once it is done
+}
+
+/**
+ * Slot function called when execute button is clicked
+ * Runs a whole frame at full speed
+ */
+void DebugWindow::_onExecute() {
+	_gb->runFrames(1);
+}
+
+/**
+ * Slot function called by the poll timer
+ * Shows the copy once written, asks for a new one when the emulation thread is idle and did something new
+ */
+void DebugWindow::_onPoll() {
+	Gbmu::Gb::Status status = _gb->status();
+
+	if (_inspecting) {
+		if (_view->ready.load())
+			_showView();
+		return;
+	}
+	if (!isVisible() || status.running || status.commands == _seen)
+		return;
 	updateUI();
 }
 
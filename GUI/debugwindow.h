@@ -3,6 +3,7 @@
 
 #include <QMainWindow>
 #include <QDebug>
+#include <QTimer>
 
 #include "../includes/Gb.class.hpp"
 #include "../includes/Registers.class.hpp"
@@ -74,7 +75,12 @@ public:
 private:
 	Ui::DebugWindow *_ui;
 	Gbmu::Gb *_gb;
+	QTimer *_poll; // watches the emulation status
+	uint64_t _seen; // last command shown
+	Gbmu::Gb::Inspection *_view; // registers and memory, copied by the emulation thread
+	bool _inspecting; // _view is being written
 
+	void _showView();
 	void _updateRegisters();
 	void _updateMemory();
 	void _connectSignals();
@@ -84,6 +90,8 @@ private slots:
 	void _onGeneralRegisterChange(QTableWidgetItem *item);
 	void _onMemoryChange(QTableWidgetItem *item);
 	void _onStep();
+	void _onExecute();
+	void _onPoll();
 	void _onInspectMemory();
 
 };
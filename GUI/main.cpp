@@ -7,6 +7,7 @@ int main(int argc, char *argv[])
 {
 	QApplication a(argc, argv); // initialize Qt application
 	Gbmu::Gb gb; // create a Gb object
+	gb.start(); // emulation runs on its own thread, the UI only posts commands
 
 	MainWindow w(0, &gb);
 
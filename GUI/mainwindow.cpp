@@ -28,6 +28,6 @@ void MainWindow::_onMenuLoad()
 {
 	QString path = QFileDialog::getOpenFileName(this, "Open file", "/home");
 
-	_gb->load(path.toStdString());
-	_dw->updateUI();
+	_gb->load(path.toStdString()); // queued, the debugger refreshes once it is done
+	_gb->play();
 }
@@ -0,0 +1,37 @@
+#ifndef ALSASINK_CLASS_HPP
+# define ALSASINK_CLASS_HPP
+
+# include <string>
+
+# include "IAudioSink.class.hpp"
+
+/*
+** Play the samples on an ALSA device ( "default" )
+** Only available when built with ALSA=1, open fails otherwise
+*/
+
+namespace Gbmu
+{
+	class AlsaSink : public IAudioSink
+	{
+		private:
+			std::string		_device;
+			void*			_pcm;			// snd_pcm_t, kept opaque so this header needs no ALSA
+
+			AlsaSink ( AlsaSink const & src );
+			AlsaSink & operator=( AlsaSink const & rhs );
+
+		public:
+			AlsaSink ( std::string const& device = "default" );
+			virtual ~AlsaSink ( void );
+
+			virtual bool	open ( unsigned int const& rate );
+			virtual void	write ( AudioSample const* samples, size_t const& count );
+			virtual void	close ( void );
+			virtual bool	realtime ( void ) const;
+
+			static bool		available ( void );
+	};
+}
+
+#endif // !ALSASINK_CLASS_HPP
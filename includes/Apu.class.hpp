@@ -0,0 +1,240 @@
+#ifndef APU_CLASS_HPP
+# define APU_CLASS_HPP
+
+# include <iostream>
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <cstring>
+# include <atomic>
+# include <mutex>
+# include <condition_variable>
+
+# include "Cpu.class.hpp"
+# include "SpscRing.class.hpp"
+# include "Scheduler.class.hpp"
+# include "Blep.class.hpp"
+# include "Mixer.class.hpp"
+# include "IAudioSink.class.hpp"
+
+/*
+
+******************************* APU ***************************************
+
+	-- Channels
+		1: square with sweep	NR10 - NR14		[0xFF10 - 0xFF14]
+		2: square				NR21 - NR24		[0xFF16 - 0xFF19]
+		3: wave ( 32 nibbles )	NR30 - NR34		[0xFF1A - 0xFF1E]	wave RAM [0xFF30 - 0xFF3F]
+		4: noise ( LFSR )		NR41 - NR44		[0xFF20 - 0xFF23]
+
+	-- Control
+		NR50 [0xFF24]	left / right master volume
+		NR51 [0xFF25]	channels panning
+		NR52 [0xFF26]	BIT 7: power, BITS 0-3: channels on ( read only )
+
+	-- Frame sequencer ( 512 Hz, every 8192 cycles )
+		step	0	1	2	3	4	5	6	7
+		length	x		x		x		x
+		sweep			x				x
+		envelope							x
+
+	Nothing is ticked per cpu cycle. The channels are brought up to date
+	( _run ) only when a register is written and on every frame sequencer
+	step, a Scheduler::APU event. Each run renders the whole block of
+	samples since the last one ( ~93 samples at 48 kHz ):
+
+		channel timers	-> output steps at their exact cycle
+						-> Blep ( one per channel, at the output rate )
+						-> Mixer ( NR50 / NR51 ) -> ring
+
+	A channel whose whole waveform is shorter than 2 output samples is
+	inaudible, its timer is skipped in one go and it outputs its average.
+	The noise LFSR is shifted by up to 14 steps at once, only the steps
+	that flip its output are looked at.
+
+	Samples are pushed in a preallocated lock-free ring, the consumer pops
+	them from any thread. On a full ring:
+
+		NONE		nobody reads, the samples are dropped
+		REALTIME	sound device, the samples are dropped: the emulation
+					never waits for a device
+		STREAM		file / pipe, the apu sleeps until the consumer read so
+					nothing is lost ( like the ppu with its render thread:
+					each side checks the other's flag after a fence )
+
+	-- Without sound ( chosen at construction )
+		Only what a game can observe is kept: registers, NR52 channel bits,
+		length counters, envelopes and sweep, all clocked by the frame
+		sequencer. The channel timers, bleps, mixer and ring are never run,
+		the renderer is picked once so nothing is tested per sample.
+
+	-- Rate control ( REALTIME consumer only )
+		The consumer runs on the sound card clock, never exactly ours.
+		After each block the output rate is nudged by at most 0.5 %
+		from the distance to a half full ring ( proportional ), plus its
+		slow sum ( integral ) that absorbs the constant clock difference:
+
+			fill < half		-> a few more samples per cycle
+			fill > half		-> a few less
+
+*/
+
+# define CPU_CLOCK				4194304
+# define AUDIO_RATE				48000
+# define AUDIO_RING_SIZE		0x2000		// stereo samples, ~170 ms at 48 kHz ( half is the target latency )
+# define AUDIO_MAX_ADJUST		200			// rate control range, 1 / 200 of the rate
+# define AUDIO_RATE_INTEGRAL	0.0002		// integral gain, per block
+# define FRAME_SEQUENCER_CYCLES	8192
+# define APU_REG_SIZE			0x30		// 0xFF10 - 0xFF3F
+# define APU_ULTRASONIC_CYCLES	(2 * CPU_CLOCK / AUDIO_RATE)
+
+namespace Gbmu
+{
+	typedef SpscRing<AudioSample, AUDIO_RING_SIZE>	AudioRing;
+
+	class Apu
+	{
+		public:
+			enum Consumer
+			{
+				NONE,
+				REALTIME,
+				STREAM
+			};
+
+			// registers offset from 0xFF10
+			enum Register
+			{
+				NR10 = 0x00, NR11, NR12, NR13, NR14,
+				NR21 = 0x06, NR22, NR23, NR24,
+				NR30 = 0x0A, NR31, NR32, NR33, NR34,
+				NR41 = 0x10, NR42, NR43, NR44,
+				NR50 = 0x14, NR51, NR52,
+				WAVE = 0x20
+			};
+
+		private:
+			struct Square
+			{
+				bool		on;
+				uint8_t		duty;
+				uint16_t	length;
+				uint16_t	freq;
+				uint32_t	timer;			// cycles until the next duty step
+				uint8_t		pos;			// duty step 0 - 7
+				uint8_t		volume;
+				uint8_t		envTimer;
+				uint8_t		sweepTimer;
+				bool		sweepOn;
+				uint16_t	shadow;			// sweep shadow frequency
+			};
+
+			struct Wave
+			{
+				bool		on;
+				uint16_t	length;
+				uint16_t	freq;
+				uint32_t	timer;
+				uint8_t		pos;			// nibble 0 - 31
+			};
+
+			struct Noise
+			{
+				bool		on;
+				uint16_t	length;
+				uint32_t	timer;
+				uint16_t	lfsr;
+				uint8_t		volume;
+				uint8_t		envTimer;
+			};
+
+			// in the arena, the samples not read yet are not part of the game
+			struct State
+			{
+				uint8_t		regs[APU_REG_SIZE];
+				Square		square[2];
+				Wave		wave;
+				Noise		noise;
+				uint8_t		sequencerStep;
+				uint64_t	lastRun;		// cycle the channels are up to date at
+			};
+
+			Cpu*			_cpu;
+			State*			_state;
+			bool const		_sound;			// samples are synthesized
+			void			(Apu::*_render)(uint64_t const& until);
+			uint64_t		_blockStart;	// cycle of the first sample not read from the bleps yet
+			uint64_t		_blockFrac;		// its position in samples, 32.32 fixed point
+			uint64_t		_ratio;			// output samples per cycle, 32.32 fixed point
+			uint64_t		_baseRatio;		// _ratio without rate control
+			std::atomic<Consumer>	_consumer;
+			double			_rateIntegral;	// rate control integral term, -1 .. 1
+			Blep			_blep[MIXER_CHANNELS];
+			float			_levels[MIXER_CHANNELS];	// last output of each channel
+			float			_samples[MIXER_CHANNELS][BLEP_BUFFER_SIZE + 4];
+			AudioSample		_block[BLEP_BUFFER_SIZE];
+			Mixer			_mixer;
+			bool			_muted;
+			AudioRing*		_ring;
+			uint64_t		_dropped;		// samples lost on a full ring
+			std::mutex				_lock;		// sleeping producer
+			std::condition_variable	_room;		// samples read or consumer changed ( STREAM producer waits )
+			std::atomic<bool>		_waiting;	// the producer sleeps on _room
+
+			Apu ( void );
+			Apu ( Apu const & src );
+			Apu & operator=( Apu const & rhs );
+
+		public:
+			Apu ( Cpu *cpu, bool const& sound = true );
+			virtual ~Apu ( void );
+
+			void			reset ( void );
+			void			onRestore ( void );		// the arena was overwritten, the samples restart from silence
+
+			uint8_t			read ( uint16_t const& addr ) const;
+			void			write ( uint16_t const& addr, uint8_t const& value );
+			void			sync ( void );
+			bool const&		sound ( void ) const;
+
+			void			setMuted ( bool const& b );
+			bool const&		muted ( void ) const;
+			void			setConsumer ( Consumer const& consumer );
+			double			rate ( void ) const;		// current output rate in Hz
+
+			// consumer side, any thread
+			size_t			readSamples ( AudioSample *out, size_t const& max );
+			AudioRing&		ring ( void ) const;
+			uint64_t const&	dropped ( void ) const;
+
+		private:
+			static void		_onEvent ( void *owner, uint64_t const& when );
+			void			_run ( uint64_t const& until );
+			void			_writeChannel ( uint8_t const& offset, uint8_t const& value );
+			void			_renderSamples ( uint64_t const& until );
+			void			_renderSilent ( uint64_t const& until );
+			void			_runSquare ( int const& i, uint64_t const& until );
+			void			_runWave ( uint64_t const& until );
+			void			_runNoise ( uint64_t const& until );
+			float			_level ( int const& channel ) const;
+			void			_setLevel ( int const& channel, uint64_t const& when );
+			void			_setLevel ( int const& channel, uint64_t const& when, float const& level );
+			void			_refresh ( void );
+			void			_flush ( void );
+			void			_waitRoom ( void );
+			uint64_t		_position ( uint64_t const& when ) const;
+			void			_adjustRate ( void );
+			void			_clockSequencer ( void );
+			void			_clockLength ( void );
+			void			_clockEnvelope ( void );
+			void			_clockSweep ( void );
+			uint16_t		_sweepFrequency ( void );
+			void			_trigger ( int const& channel );
+			void			_power ( bool const& on );
+			bool			_dac ( int const& channel ) const;
+	};
+}
+
+#else
+namespace Gbmu {
+	class Apu;
+}
+#endif // !APU_CLASS_HPP
@@ -0,0 +1,57 @@
+#ifndef AUDIOOUTPUT_CLASS_HPP
+# define AUDIOOUTPUT_CLASS_HPP
+
+# include <iostream>
+# include <atomic>
+# include <thread>
+
+# include "IAudioSink.class.hpp"
+# include "Apu.class.hpp"
+
+/*
+
+***************************** AUDIO OUTPUT *********************************
+
+	Thread between the apu ring and a sink:
+
+		emulation thread			audio thread
+		apu ( push ) --> [ lock-free ring ] --> ( pop ) sink->write
+
+	A blocking sink only blocks the audio thread. With a realtime sink the
+	emulation never waits ( a full ring drops samples ) and the apu rate
+	control is on, with a file sink the apu waits for room instead.
+
+*/
+
+# define AUDIO_BLOCK	512			// samples handed to the sink at once
+
+namespace Gbmu
+{
+	class AudioOutput
+	{
+		private:
+			Apu*				_apu;
+			IAudioSink*			_sink;
+			std::thread*		_thread;
+			std::atomic<bool>	_stop;
+			AudioSample			_buffer[AUDIO_BLOCK];
+
+			AudioOutput ( void );
+			AudioOutput ( AudioOutput const & src );
+			AudioOutput & operator=( AudioOutput const & rhs );
+
+		public:
+			AudioOutput ( Apu *apu );
+			virtual ~AudioOutput ( void );
+
+			bool				start ( IAudioSink *sink );
+			void				stop ( void );
+			IAudioSink*			sink ( void ) const;
+
+		private:
+			void				_loop ( void );
+			size_t				_drain ( void );
+	};
+}
+
+#endif // !AUDIOOUTPUT_CLASS_HPP
@@ -0,0 +1,60 @@
+#ifndef BLEP_CLASS_HPP
+# define BLEP_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stddef.h>
+# include <cstring>
+
+/*
+
+************************** BAND-LIMITED STEPS *****************************
+
+	A channel output only changes by steps ( duty edge, new wave nibble,
+	LFSR bit, volume change ). Instead of evaluating the channel at every
+	cycle and decimating, each step is added once, at its exact fractional
+	position in the output samples, as a band-limited impulse:
+
+		delta at 3.4	->	kernel of phase 0.4 added on samples 3 .. 3 + TAPS
+
+	read() integrates those impulses back into the band-limited signal,
+	so the cost only depends on the number of steps and output samples.
+
+	The kernel is a blackman windowed sinc cut at 0.45 * output rate,
+	stored for BLEP_PHASES fractional positions.
+	Output is delayed by BLEP_TAPS / 2 samples so a step never touches
+	samples already read.
+
+	The integrator leaks slowly: DC is removed like the gameboy output
+	capacitor does.
+
+*/
+
+# define BLEP_PHASES		32
+# define BLEP_TAPS			16
+# define BLEP_BUFFER_SIZE	1024		// samples per read, at most
+# define BLEP_LEAK			0.9995f
+
+namespace Gbmu
+{
+	class Blep
+	{
+		private:
+			float			_buffer[BLEP_BUFFER_SIZE + BLEP_TAPS];
+			float			_sum;
+
+			Blep ( Blep const & src );
+			Blep & operator=( Blep const & rhs );
+
+		public:
+			Blep ( void );
+			virtual ~Blep ( void );
+
+			void			clear ( void );
+
+			// pos in output samples, 32.32 fixed point
+			void			addDelta ( uint64_t const& pos, float const& delta );
+			void			read ( float *out, size_t const& count );
+	};
+}
+
+#endif // !BLEP_CLASS_HPP
@@ -0,0 +1,119 @@
+#ifndef BOOTCACHE_CLASS_HPP
+# define BOOTCACHE_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stddef.h>
+# include <string>
+
+# include "SaveState.class.hpp"
+
+/*
+
+****************************** BOOT CACHE **********************************
+
+	Skips the boot and the intro of a ROM on every run but the first one.
+
+	The first run goes to the point asked ( a frame, or the first time
+	the pc reaches an address ) and saves the state there in a cache
+	file of its own. The next runs map that file, check its key and load
+	the state at once:
+
+		Gb::boot ( dir, FRAME, 600 )
+			dir/TITLE-checksum-cgb-f600.gbmb	matches the key	->	load its state
+												missing / stale	->	run 600 frames, save
+
+	-- Key
+		cartridge global checksum, type and ROM size ( header bytes 0x147
+		and 0x148 ), Gb model, emulator version ( GB_VERSION ) and the
+		point. Anything else is stale and recorded again: a new build of
+		the emulator never loads the states of an older one, a ROM hack
+		keeping the checksum but not the mapper never loads the original's.
+
+	-- File
+		One per ROM, model and point ( all in its name, pc points as
+		pcXXXX ), a Header then the state ( a plain SaveState ):
+
+			+------------------------------------+
+			| "GBMB"  format  checksum           |
+			| version  model  trigger  type      |	Header, 48 bytes
+			| romSize  size                      |
+			| at  frames                         |
+			+------------------------------------+
+			| "GBMS" ..                          |	state, size bytes
+			+------------------------------------+
+
+		It is written aside and renamed over the old one, jobs running
+		the same ROM at once never read half a file. A file that cannot
+		be written fails Gb::boot, the run is at the point all the same.
+
+*/
+
+# define BOOTCACHE_MAGIC		"GBMB"
+# define BOOTCACHE_FORMAT		2
+# define BOOTCACHE_EXT			".gbmb"
+# define BOOTCACHE_PC_CYCLES	(3600ULL * 70224)	// a minute to reach the pc
+
+namespace Gbmu
+{
+	class BootCache
+	{
+		public:
+			enum Trigger
+			{
+				FRAME,			// after at frames from power on
+				PC				// the first time the pc is at
+			};
+
+			struct Key
+			{
+				uint16_t	checksum;		// cartridge global checksum
+				uint8_t		model;			// Gb::Model
+				uint8_t		trigger;		// Trigger
+				uint8_t		type;			// cartridge type ( MBC )
+				uint8_t		romSize;		// header ROM size code
+				uint64_t	at;				// frames, or pc
+			};
+
+			struct Header
+			{
+				char		magic[4];
+				uint16_t	format;
+				uint16_t	checksum;
+				char		version[16];	// GB_VERSION, NUL terminated
+				uint8_t		model;
+				uint8_t		trigger;
+				uint8_t		type;
+				uint8_t		romSize;
+				uint32_t	size;			// state bytes
+				uint64_t	at;
+				uint64_t	frames;			// frames run until the state
+			};
+
+		private:
+			uint8_t const*	_map;			// mapped file, NULL when closed
+			size_t			_mapped;		// bytes
+
+			BootCache ( BootCache const & src );
+			BootCache & operator=( BootCache const & rhs );
+
+		public:
+			BootCache ( void );
+			virtual ~BootCache ( void );
+
+			static std::string	path ( std::string const& dir, std::string const& title, Key const& key );
+			static bool			write ( std::string const& path, Key const& key, uint64_t const& frames,
+									SaveState const& state );
+
+			bool				open ( std::string const& path, Key const& key );	// map it, false if missing or stale
+			void				close ( void );
+			uint8_t const*		state ( void ) const;
+			size_t				size ( void ) const;
+			uint64_t			frames ( void ) const;
+	};
+}
+
+#else
+namespace Gbmu {
+	class BootCache;
+}
+#endif // !BOOTCACHE_CLASS_HPP
@@ -0,0 +1,102 @@
+#ifndef CAPTURE_CLASS_HPP
+# define CAPTURE_CLASS_HPP
+
+# include <iostream>
+# include <fstream>
+# include <string>
+# include <vector>
+# include <set>
+# include <cstdio>
+# include <thread>
+# include <mutex>
+# include <condition_variable>
+
+# include "IScreen.class.hpp"
+
+/*
+
+********************** HEADLESS FRAME CAPTURE ******************************
+
+	Capture is a screen that writes frames instead of displaying them.
+
+	-- PNG		chosen frames, one file per frame ( <prefix>_<frame>.png )
+	-- RAW		every frame, 160x144 RGB24, no header
+	-- Y4M		every frame, YUV4MPEG2 4:4:4 at 4194304/70224 fps
+
+	The emulation side only copies the pixels in a bounded queue of
+	preallocated slots, a writer thread does the encoding and the I/O.
+
+		ppu ( onFrame ) --> [ slot | slot | .. | slot ] --> writer thread --> disk / pipe
+
+	The ppu only waits when every slot is full ( disk slower than emulation
+	for longer than the queue depth ).
+	Frames are numbered from 1, like Ppu::frame().
+
+*/
+
+# define CAPTURE_DEPTH	16		// default queue depth ( frames )
+
+namespace Gbmu
+{
+	class Capture : public IScreen
+	{
+		public:
+			enum Format
+			{
+				NONE,
+				RAW,
+				Y4M
+			};
+
+		private:
+			struct Slot
+			{
+				uint64_t		frame;
+				bool			png;		// also write this frame as PNG
+				uint32_t*		pixels;
+			};
+
+			std::vector<Slot>		_slots;			// preallocated queue
+			size_t					_head;			// oldest queued slot
+			size_t					_count;			// queued slots
+			std::mutex				_mutex;
+			std::condition_variable	_notEmpty;
+			std::condition_variable	_notFull;
+			std::thread*			_thread;		// writer thread
+			bool					_stop;
+
+			std::set<uint64_t>		_pngFrames;		// frames to write as PNG
+			std::string				_pngPrefix;
+			FILE*					_stream;		// RAW / Y4M output
+			Format					_format;
+			uint8_t*				_buffer;		// writer thread conversion buffer
+
+			Capture ( Capture const & src );
+			Capture & operator=( Capture const & rhs );
+
+		public:
+			Capture ( size_t const& depth = CAPTURE_DEPTH );
+			virtual ~Capture ( void );
+
+			void			addPngFrame ( uint64_t const& frame );
+			void			setPngPrefix ( std::string const& prefix );
+			bool			openStream ( std::string const& path, Format const& format );
+
+			void			start ( void );
+			void			stop ( void );
+
+			virtual void	onFrame ( uint32_t const* pixels, uint64_t const& frame );
+
+			static bool		writePng ( std::string const& path, uint32_t const* pixels );
+
+		private:
+			void			_writerLoop ( void );
+			void			_writeStream ( uint32_t const* pixels );
+	};
+}
+
+#else
+namespace Gbmu {
+	class Capture;
+}
+#endif // !CAPTURE_CLASS_HPP
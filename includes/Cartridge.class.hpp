@@ -5,10 +5,12 @@
 # include <fstream>
 # include <inttypes.h> //Allow uint8_t on Debian
 # include <string.h>
+# include <memory>
 
 # define CARTRIDGE_SIZE 0x8000
 
 # include "Gb.class.hpp"
+# include "SaveState.class.hpp"
 
 /*
 
@@ -77,7 +79,9 @@ public:
 private:
 	std::string					_path;		// ROM file path
 	Gb::Model					_model;		// GB forced model
+	std::shared_ptr<uint8_t>	_rom;		// owns the data, shared by the copies ( read only )
 	uint8_t*					_data;		// pointer on cartridge data
+	size_t						_size;		// ROM file size
 	struct Header				_header;	// cartridge header
 	//		IMBController*				_mbc;		// MBC ( Controller for extended data of cartridge )
 
@@ -85,7 +89,7 @@ private:
 public:
 	Cartridge (std::string const& path, Gb::Model const& model);
 	virtual ~Cartridge ( void );
-	Cartridge(Cartridge const & src);
+	Cartridge(Cartridge const & src);		// same ROM, not copied
 	Cartridge & operator=(Cartridge const & rhs);
 
 	/*NI*/	void							reset ( void );
@@ -101,10 +105,12 @@ public:
 
 	/*NWI*/	struct Cartridge::Header const&	header ( void ) const;
 	uint8_t*						data ( void ) const;
+	size_t const&					size ( void ) const;
 	std::string const&				path ( void ) const;
 
-	/*NI*/	void							saveState ( std::fstream& file );
-	/*NI*/	void							loadState ( std::fstream& file );
+	// no banking state yet, only what tells the game apart
+	void							saveState ( SaveState& state ) const;
+	bool							loadState ( SaveState& state );		// false for another game
 
 private:
 	/*NWI*/	void							load( void );
@@ -7,30 +7,66 @@
 # include "Cartridge.class.hpp"
 # include "Registers.class.hpp"
 # include "Instructions.class.hpp"
+# include "Ppu.class.hpp"
+# include "Scheduler.class.hpp"
+# include "Timer.class.hpp"
+# include "Interrupts.class.hpp"
+# include "Joypad.class.hpp"
+# include "Apu.class.hpp"
+# include "SaveState.class.hpp"
+# include "StateArena.class.hpp"
 
 namespace Gbmu{
 	class Cpu
 	{
 		private:
+			// in the arena
+			struct State
+			{
+				bool		boot;			// Booting Flag
+				bool		halt;			// Halting Flag
+			};
+
+			StateArena		*_arena;		// the whole machine state, in one block
 			Registers		*_regs;			// general registers (A, B, ..)
+			State			*_state;		// flags
 			Memory			*_memory;		// gb memory
 			Cartridge		*_cartridge;	// loaded cartridge
 			Instructions	*_instructions;	// cpu instruction set
+			Scheduler		*_scheduler;	// clock and components events
+			Interrupts		*_interrupts;	// IF / IE / IME
+			Joypad			*_joypad;		// P1 keys
+			Ppu				*_ppu;			// pixel processing unit
+			Timer			*_timer;		// DIV / TIMA timer
+			Apu				*_apu;			// audio processing unit
 			uint16_t		_pc;			// program counter (address of the current instruction)
 			uint16_t		_sp;			// stack pointer
-			bool			_BOOT;			// Booting Flag
-			bool			_HALT;			// Halting Flag
 			//bool			_doubleSpeed;	// DoubleSpeed Flag (CGB ONLY)
 
+			uint64_t		_end ( uint64_t const& cycles ) const;
+			void			_insert ( Cartridge *cartridge );
+			void			_restored ( void );
+
 		public:
-			Cpu ( void );
+			Cpu ( bool const& sound = true );
 			virtual ~Cpu ( void );
 
-			/*NI*/		void		reset ( void );
-			/*NI*/		void		loadCartridge ( std::string const& cartridgePath, Gb::Model const& model );
+			void		reset ( void );		// power cycle, the cartridge stays in
+			void		loadCartridge ( std::string const& cartridgePath, Gb::Model const& model );	// throws, the cpu unchanged
+			void		loadCartridge ( Cartridge const& cartridge );	// same ROM, shared
 
 			void		executeFrame ( void );
-			/*NI*/size_t		execute ( void );
+			size_t		execute ( void );
+			void		runSlice ( uint64_t const& limit );
+			void		step ( void );		// one instruction, same clock as the slices
+			void		runFrame ( void );
+
+			// Run until a stop condition, at most cycles long ( true if the condition was met )
+			// conditions are checked between slices ( at every event ), the pc before each instruction
+			uint64_t	runFor ( uint64_t const& cycles );		// return the cycles run ( instructions are whole )
+			bool		runUntilPc ( uint16_t const& pc, uint64_t const& cycles = NO_DEADLINE );
+			void		runFrames ( size_t const& frames );
+			bool		runUntil ( RunCondition condition, void *data, uint64_t const& cycles = NO_DEADLINE );
 
 			/*NI*/		void		onWriteKey1 ( uint8_t const& value );
 			/*NI*/		void		switchSpeed ( void );
@@ -42,13 +78,27 @@ namespace Gbmu{
 			bool const&				onBoot ( void ) const;
 
 			Registers *				regs(void) const;
+			StateArena*				arena ( void ) const;
 			Memory*					memory ( void ) const;
 			Cartridge*				cartridge ( void ) const;
+			Instructions*			instructions ( void ) const;
+			Ppu*					ppu ( void ) const;
+			Scheduler*				scheduler ( void ) const;
+			Timer*					timer ( void ) const;
+			Interrupts*				interrupts ( void ) const;
+			Joypad*					joypad ( void ) const;
+			Apu*					apu ( void ) const;
 			uint16_t				pc(void) const;
 			uint16_t				sp(void) const;
 
-			/*NI*/		void		saveState ( std::fstream& file );
-			/*NI*/		void		loadState ( std::fstream& file );
+			// the cartridge identity then the arena, loading fails on another game's state
+			// a failed load leaves the machine as it was
+			void		saveState ( SaveState& state ) const;
+			bool		loadState ( SaveState& state );
+			// a state of this build and game, only overwritten: no check
+			bool		restore ( SaveState& state );
+			// the arena of a cpu with the same cartridge ( StateArena::share ), copy on write
+			bool		attach ( int const& fd );
 	};
 }
 #else
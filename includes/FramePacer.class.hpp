@@ -0,0 +1,80 @@
+#ifndef FRAMEPACER_CLASS_HPP
+# define FRAMEPACER_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stdint.h>
+
+/*
+
+***************************** FRAME PACER **********************************
+
+	Hold each frame until its deadline, at GB_FPS times the speed
+	( 0.5, 1, 2.5 .. ). A speed of 0 is unlimited, wait only counts frames.
+
+	Deadlines are absolute ( base + frames * period ) so lateness never
+	accumulates. The thread sleeps with clock_nanosleep on the monotonic
+	clock until PACER_SPIN_NS before the deadline, then spins the rest:
+	the kernel wake up latency is hidden without burning a core.
+
+		base				deadline N-1		deadline N
+		 |--------------------|-------------------|
+								 sleep	  | spin |
+
+	When the emulation falls behind by more than PACER_MAX_LATE_NS
+	( breakpoint, loading a state .. ) the base restarts from now instead
+	of running frames in a burst to catch up.
+
+	Each second stats() is refreshed with the achieved fps and the jitter
+	( how late the frames were released, mean and max ). Before the first
+	second is over, it reports the frames seen so far.
+
+*/
+
+# define GB_FPS				(4194304.0 / 70224.0)	// 59.7275 Hz
+# define PACER_SPIN_NS		100000					// 100 us
+# define PACER_MAX_LATE_NS	100000000				// 100 ms
+
+namespace Gbmu
+{
+	class FramePacer
+	{
+		public:
+			struct Stats
+			{
+				double		fps;
+				double		jitterMean;		// microseconds
+				double		jitterMax;		// microseconds
+			};
+
+		private:
+			double			_speed;
+			double			_period;		// nanoseconds per frame
+			int64_t			_base;			// deadlines origin
+			uint64_t		_frames;		// frames since _base
+			int64_t			_windowStart;
+			uint64_t		_windowFrames;
+			int64_t			_lateSum;
+			int64_t			_lateMax;
+			Stats			_stats;
+
+			FramePacer ( FramePacer const & src );
+			FramePacer & operator=( FramePacer const & rhs );
+
+		public:
+			FramePacer ( double const& speed = 1 );
+			virtual ~FramePacer ( void );
+
+			void			setSpeed ( double const& speed );
+			double const&	speed ( void ) const;
+			void			restart ( void );
+			void			wait ( void );
+			Stats			stats ( void ) const;
+
+			static int64_t	now ( void );		// monotonic nanoseconds
+
+		private:
+			void			_count ( int64_t const& now, int64_t const& late );
+	};
+}
+
+#endif // !FRAMEPACER_CLASS_HPP
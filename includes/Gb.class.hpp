@@ -3,6 +3,39 @@
 
 /*
 ** This class represent the game boy object
+**
+** Without start(), every control runs at once on the calling thread.
+** After start(), the emulation runs on its own thread: load, play, pause,
+** step, reset and the states are queued as commands ( never blocking the
+** caller ) and the thread publishes its status in atomics, read by
+** status() from any thread. Screen, logs and sound are set before start().
+** The queue is preallocated ( GB_COMMANDS ), posting never allocates;
+** snapshot, restore and fork wait for their command to have run.
+**
+** The run commands ( runFor, runUntilPc, runFrames, runUntil ) pause the
+** game and run without pacing, checking their stop condition only between
+** slices of the cpu loop: millions of instructions per call for scripts
+** and the debugger. With the thread they return true once queued, the
+** result is in status().reached.
+**
+** Keys are set with setButtons() from any thread and pressed at the start
+** of the next frame. A movie records the keys of every runFrame() from a
+** snapshot, and plays them back from it bit for bit ( the run commands
+** and rewind are not part of a movie ).
+**
+** fork(k) branches k emulators from the current frame: the arena is
+** shared once and each branch maps it copy on write ( StateArena ), a
+** page is copied only for the branch writing it. The ROM is shared by
+** all of them ( read only ), the rest of a branch ( frame buffer, sound,
+** render log ) is its own. Branches are plain paused Gbs, each one can
+** run on its own thread ( start ) or be driven by runFrame.
+**
+** boot() goes to a frame or a pc right after load, from the ROM boot
+** cache ( BootCache ) when a previous run of this build recorded it.
+**
+** A debugger never touches cpu() while the thread runs: inspect() has the
+** thread copy the registers and the memory into an Inspection between two
+** commands, setRegister() and poke() are queued like any other control.
 */
 
 # include <iostream>
@@ -11,10 +44,37 @@
 # include <cstring>
 # include <sstream> //for osstringstream
 # include <iomanip> // std::setfill, std::setw
+# include <thread>
+# include <atomic>
+# include <mutex>
+# include <condition_variable>
+# include <vector>
+# include <stdint.h>
+
+# include "IScreen.class.hpp"
+# include "HashLog.class.hpp"
+# include "IAudioSink.class.hpp"
+# include "MpscQueue.class.hpp"
+# include "StateCodec.class.hpp"
+# include "BootCache.class.hpp"
+
+# define GB_IDLE_MS		2		// paused thread polling period
+# define GB_COMMANDS	256		// commands queued at most ( a power of 2 )
+# define GB_VERSION		"1.0"	// bump when the emulation changes ( boot caches key )
 
 namespace Gbmu
 {
 	class Cpu;
+	class AudioOutput;
+	class FramePacer;
+	class Rewind;
+	class Movie;
+
+	// runUntil stop condition, called with the data given
+	typedef bool (*RunCondition)(Cpu *cpu, void *data);
+
+	// opaque machine state in memory, keeps its capacity when reused
+	typedef SaveState	Snapshot;
 
 	class Gb
 	{
@@ -26,27 +86,159 @@ namespace Gbmu
 				CGB//Game Boy Color (color), introduced on October 21, 1998
 			};
 
+			struct Status
+			{
+				bool		loaded;
+				bool		running;
+				uint64_t	frames;			// frames run
+				uint64_t	commands;		// commands done, changes after each one
+				uint64_t	errors;			// commands failed ( or runs that did not reach their condition )
+				uint16_t	pc;				// after the last frame or step
+				bool		reached;		// the last run met its stop condition
+				bool		movie;			// a movie is recording or playing
+			};
+
+			enum Register
+			{
+				AF,
+				BC,
+				DE,
+				HL,
+				SP,
+				PC
+			};
+
+			// written by the thread, read once ready is set
+			struct Inspection
+			{
+				uint16_t			registers[6];		// Register order
+				uint8_t				memory[0x10000];	// as the cpu reads it
+				uint64_t			commands;			// status().commands once written
+				std::atomic<bool>	ready;
+			};
+
 		private:
+			// result of a command its caller waits for
+			struct Reply
+			{
+				std::mutex				lock;
+				std::condition_variable	done;
+				int						result;		// 0 while queued, 1 done, -1 failed
+			};
+
+			struct Command
+			{
+				enum Type
+				{
+					LOAD,
+					PLAY,
+					PAUSE,
+					RUN_FOR,
+					RUN_UNTIL_PC,
+					RUN_FRAMES,
+					RUN_UNTIL,
+					RESET,
+					SPEED,
+					SAVE_STATE,
+					LOAD_STATE,
+					SNAPSHOT,
+					RESTORE,
+					REWIND,
+					MOVIE_RECORD,
+					MOVIE_PLAY,
+					MOVIE_STOP,
+					FORK,
+					BOOT,
+					INSPECT,
+					SET_REGISTER,
+					POKE,
+					QUIT
+				};
+
+				Type		type;
+				std::string	path;
+				double		speed;
+				uint64_t	count;			// cycles, frames, or the value set
+				uint16_t	pc;				// or the register / address set
+				StateCodec::Codec	codec;	// SAVE_STATE, level in count
+				BootCache::Trigger	trigger;	// BOOT, at in count
+				RunCondition	condition;
+				void*		data;
+				std::vector<Gb*>	branches;
+				Reply*		reply;			// set once done ( or failed ), NULL if nobody waits
+
+				Command ( void ) : reply(NULL) {}
+			};
+
 			Gb::Model 		_model;			// Gb model
 			Cpu*			_cpu;			// the gameboy CPU
+			AudioOutput*	_audio;			// feeds the audio sink from its own thread
+			FramePacer*		_pacer;			// holds runFrame to the speed
+			SaveState*		_state;			// save state buffer, reused
+			Rewind*			_rewind;		// history, NULL when disabled
+			size_t			_rewindInterval;// frames between captures
+			size_t			_sinceCapture;	// frames since the last capture
+			Movie*			_movie;			// keys recorded or played
+			std::string		_moviePath;		// written when the recording stops
 			// Debugger*	_debugger;		// the gameboy debugger
-			// std::thread*	_thread;		// running thread
+			std::thread*	_thread;		// running thread
+			MpscQueue<Command, GB_COMMANDS>	_commands;	// to the running thread
 			bool			_play;			// playing flag
-			size_t			_speed;
+			std::atomic<bool>		_loaded;
+			std::atomic<bool>		_running;
+			std::atomic<uint64_t>	_frames;
+			std::atomic<uint64_t>	_done;
+			std::atomic<uint64_t>	_errors;
+			std::atomic<uint16_t>	_pc;
+			std::atomic<bool>		_reached;
+			std::atomic<bool>		_movieOn;
+			std::atomic<uint8_t>	_buttons;		// live keys, Joypad::Button mask
 
 		public:
-			Gb(void);
+			// sound false: no sample is ever synthesized ( registers still behave )
+			Gb(bool const& sound = true);
 			virtual ~Gb(void);
 			Gb(Gb const & src);
 			Gb & operator=(Gb const & rhs);
 
+			// Emulation thread
+			void			start ( void );
+			void			stop ( void );		// after the commands already queued
+
 			// Load a cartridge
 			void			load ( std::string const& cartridgePath );
-			/*NI*/	// bool			saveState ( std::string const& path );
-			/*NI*/	// bool			loadState ( std::string const& path );
+			// with a thumbnail and listed in the ROM index ( StateIndex ), compressed
+			// with codec ( level 0: its default ); loadState reads every codec built in
+			bool			saveState ( std::string const& path, StateCodec::Codec const& codec = StateCodec::NONE,
+								int const& level = 0 );		// false if it failed at once
+			bool			loadState ( std::string const& path );
+			// in memory, no file and no allocation once blob is large enough
+			// with the thread, they return once it wrote / read blob between two frames
+			bool			snapshot ( Snapshot& blob );
+			bool			restore ( Snapshot& blob );		// a snapshot of this Gb ( or a fork )
+			// record from now on, path is written by stopMovie() ( or the destructor )
+			bool			recordMovie ( std::string const& path );
+			// back to the movie start, its keys replace the live ones until its end
+			bool			playMovie ( std::string const& path );
+			bool			stopMovie ( void );
+			// k paused copies of this Gb, to delete; returns once they are filled ( none on failure )
+			std::vector<Gb*>	fork ( size_t const& k );
+			// right after load: to frame at ( or the first time pc is at ), loaded from
+			// the boot cache of the ROM in cacheDir, recorded there on a miss ( false if
+			// the point is not reached or its cache cannot be written )
+			bool			boot ( std::string const& cacheDir, BootCache::Trigger const& trigger,
+								uint64_t const& at );
 
-			// // set your gui screen to gameBoy screen
-			/*NI*/	// void			setScreen ( IScreen* screen );
+			// set your gui screen to gameBoy screen
+			void			setScreen ( IScreen* screen );
+			// hash every completed frame in log ( NULL to stop )
+			void			setHashLog ( HashLog* log );
+			// play the sound on sink ( NULL to stop, queued samples are flushed first )
+			bool			setAudioSink ( IAudioSink* sink );
+			// render lines on a dedicated thread ( same pixels as inline rendering )
+			void			setRenderThread ( bool const& b );
+			// keep a state every interval frames, in memory bytes at most ( 0 to stop )
+			void			setRewind ( size_t const& memory, size_t const& interval );
 
 			// the the GameBoy model to use
 			void			setModel ( Gb::Model const& model);
@@ -54,14 +246,29 @@ namespace Gbmu
 			// Controls
 			void			play ( void );
 			void			pause ( void );
-			/*NI*/	//	void			reset ( void );
-			void			setSpeed ( size_t const& speed); // x1 , x2, ........
-			/*NI*/	//	void			mute ( bool const& b );
+			void			step ( void );		// one instruction
+			bool			runFor ( uint64_t const& cycles );
+			bool			runUntilPc ( uint16_t const& pc, uint64_t const& cycles = UINT64_MAX );
+			bool			runFrames ( size_t const& frames );
+			bool			runUntil ( RunCondition condition, void *data, uint64_t const& cycles = UINT64_MAX );
+			void			reset ( void );
+			bool			rewind ( void );		// back interval frames
+			void			setSpeed ( double const& speed ); // x0.5, x1, x2 .. 0 is unlimited
+			void			runFrame ( void );		// returns at the frame deadline, not with start()
+			void			mute ( bool const& b );
+			void			setButtons ( uint8_t const& buttons );	// Joypad::Button mask, any thread
+
+			// Debugger, with the thread view is written when the command runs
+			bool			inspect ( Inspection& view );
+			bool			setRegister ( Register const& reg, uint16_t const& value );
+			bool			poke ( uint16_t const& addr, uint8_t const& value );
 
 			// Infos
 			bool			isLoaded ( void ) const; //Singelton to check-is the current cartridge is load
 			bool			isRunning ( void ) const; //Singelton to check-is the current cartridge is run
-			/*NI*/	// size_t			speed ( void ) const;
+			Gb::Status		status ( void ) const;
+			double const&	speed ( void ) const;
+			void			pacing ( double& fps, double& jitterMean, double& jitterMax ) const;	// last second, jitter in us
 			Gb::Model		model ( void ) const;//Getter to _Model
 			std::string		gameTitle ( void ) const;
 
@@ -73,6 +280,21 @@ namespace Gbmu
 
 		private:
 			void			_run ( void );
+			bool			_post ( Command& command );
+			bool			_post ( Command::Type const& type, std::string const& path = "", double const& speed = 0 );
+			bool			_call ( Command& command );
+			bool			_execute ( Command const& command );
+			void			_reply ( Command const& command, bool const& ok );
+			bool			_saveState ( std::string const& path, StateCodec::Codec const& codec, int const& level );
+			bool			_loadState ( std::string const& path );
+			bool			_recordMovie ( std::string const& path );
+			bool			_playMovie ( std::string const& path );
+			bool			_stopMovie ( void );
+			bool			_fork ( std::vector<Gb*> const& branches );
+			bool			_boot ( std::string const& cacheDir, BootCache::Trigger const& trigger,
+								uint64_t const& at );
+			void			_inspect ( Inspection& view );
+			bool			_setRegister ( Register const& reg, uint16_t const& value );
 	};
 
 }
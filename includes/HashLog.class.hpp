@@ -0,0 +1,63 @@
+#ifndef HASHLOG_CLASS_HPP
+# define HASHLOG_CLASS_HPP
+
+# include <iostream>
+# include <fstream>
+# include <string>
+# include <inttypes.h> //Allow uint8_t on Debian
+
+/*
+
+************************** FRAME HASH LOG *********************************
+
+	One 64 bits hash per completed frame, computed by the ppu right after
+	the frame is rendered. Runs are compared by their logs instead of
+	their pixels.
+
+	File format ( little endian ):
+
+	+--------+---------+--------------+--------------+-----
+	| "GBHL" | version | hash frame 1 | hash frame 2 | ...
+	+--------+---------+--------------+--------------+-----
+	  4B		4B		  8B			 8B
+
+	Hash: xxHash3 style, 8 independent 64 bits lanes per 64 bytes stripe
+	with a 32x32->64 multiply, the loop is vectorized by the compiler
+	( SSE2 pmuludq / AVX2 vpmuludq ).
+
+*/
+
+# define HASHLOG_MAGIC		"GBHL"
+# define HASHLOG_VERSION	1
+
+namespace Gbmu
+{
+	class HashLog
+	{
+		private:
+			std::ofstream		_file;
+			uint64_t			_frames;		// hashes written
+
+			HashLog ( HashLog const & src );
+			HashLog & operator=( HashLog const & rhs );
+
+		public:
+			HashLog ( void );
+			virtual ~HashLog ( void );
+
+			bool				open ( std::string const& path );
+			void				close ( void );
+			void				append ( uint64_t const& hash );
+			uint64_t			frames ( void ) const;
+
+			static uint64_t		hash ( void const* data, size_t const& size );
+			static bool			load ( std::string const& path, std::string& hashes );
+			static int			compare ( std::string const& pathA, std::string const& pathB );
+	};
+}
+
+#else
+namespace Gbmu {
+	class HashLog;
+}
+#endif // !HASHLOG_CLASS_HPP
@@ -0,0 +1,50 @@
+#ifndef IAUDIOSINK_CLASS_HPP
+# define IAUDIOSINK_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stddef.h>
+
+/*
+** Interface for everything that wants the gameboy sound (sound device, wav file..)
+**
+** Samples are 16 bits signed stereo, interleaved. write is called from the
+** audio output thread, never from the emulation thread, so a sink may block
+** ( a sound device waiting for room ) without slowing the emulation down.
+**
+** A realtime sink consumes samples at its own clock: the apu then nudges its
+** output rate to keep the ring between them half full and drops samples
+** rather than wait for it. Other sinks get every sample.
+*/
+
+namespace Gbmu
+{
+	struct AudioSample
+	{
+		int16_t		left;
+		int16_t		right;
+	};
+
+	class IAudioSink
+	{
+		public:
+			virtual ~IAudioSink ( void ) {}
+			virtual bool	open ( unsigned int const& rate ) = 0;
+			virtual void	write ( AudioSample const* samples, size_t const& count ) = 0;
+			virtual void	close ( void ) = 0;
+			virtual bool	realtime ( void ) const = 0;
+	};
+
+	/*
+	** Drop every sample ( benchmarks, headless runs that need the timing only )
+	*/
+	class NullSink : public IAudioSink
+	{
+		public:
+			virtual bool	open ( unsigned int const& rate ) { (void)rate; return (true); }
+			virtual void	write ( AudioSample const* samples, size_t const& count ) { (void)samples; (void)count; }
+			virtual void	close ( void ) {}
+			virtual bool	realtime ( void ) const { return (false); }
+	};
+}
+
+#endif // !IAUDIOSINK_CLASS_HPP
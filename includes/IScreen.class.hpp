@@ -0,0 +1,28 @@
+#ifndef ISCREEN_CLASS_HPP
+# define ISCREEN_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stddef.h>
+
+# define SCREEN_WIDTH	160
+# define SCREEN_HEIGHT	144
+
+/*
+** Interface for everything that wants the gameboy pixels (gui, headless capture..)
+**
+** onFrame is called once per completed frame with SCREEN_WIDTH * SCREEN_HEIGHT
+** pixels in 0xAARRGGBB format. When the Ppu renders on its own thread
+** onFrame is called from that thread, so the pixels must be copied before returning.
+*/
+
+namespace Gbmu
+{
+	class IScreen
+	{
+		public:
+			virtual ~IScreen ( void ) {}
+			virtual void	onFrame ( uint32_t const* pixels, uint64_t const& frame ) = 0;
+	};
+}
+
+#endif // !ISCREEN_CLASS_HPP
@@ -27,7 +27,8 @@ namespace Gbmu {
 		public:
 		Instructions(Cpu *cpu);
 		virtual		~Instructions(void);
-		void		execute(uint8_t opcode);
+		int			execute(uint8_t opcode);
+		std::string const&	name(uint8_t opcode, uint8_t cb) const;	// mnemonic, cb is the byte after a 0xcb prefix
 
 		private:
 		Instructions(void);						// fordib instanciation without Cpu
@@ -0,0 +1,98 @@
+#ifndef INTERRUPTS_CLASS_HPP
+# define INTERRUPTS_CLASS_HPP
+
+# include <iostream>
+# include <inttypes.h> //Allow uint8_t on Debian
+
+# include "Cpu.class.hpp"
+
+/*
+
+***************************** INTERRUPTS ***********************************
+
+	-- IF Register (interrupt flag) [0xFF0F]
+	-- IE Register (interrupt enable) [0xFFFF]
+		BIT 0: 	V-Blank		-> 0x40
+		BIT 1: 	LCD STAT	-> 0x48
+		BIT 2: 	Timer		-> 0x50
+		BIT 3: 	Serial		-> 0x58
+		BIT 4: 	Joypad		-> 0x60
+
+	-- IME (interrupt master enable), not addressable
+		DI clears it at once, EI sets it after the next instruction,
+		RETI sets it at once
+
+	The cpu only tests pending() before each instruction, it is non zero
+	when an enabled interrupt is requested or when EI is waiting.
+	It is updated on IF / IE writes, on requests and on EI / DI / RETI,
+	never computed in the hot loop.
+	A requested interrupt wakes a halted cpu even when IME is off.
+
+*/
+
+# define INTERRUPT_VECTOR		0x40
+# define INTERRUPT_CYCLES		20
+# define EI_WAITING				0x80	// pending() bit while EI is delayed
+
+namespace Gbmu
+{
+	class Interrupts
+	{
+		public:
+			enum Interrupt
+			{
+				VBLANK = 0x01,
+				LCD_STAT = 0x02,
+				TIMER = 0x04,
+				SERIAL = 0x08,
+				JOYPAD = 0x10
+			};
+
+		private:
+			// in the arena
+			struct State
+			{
+				uint8_t		flag;			// IF
+				uint8_t		enable;			// IE
+				bool		ime;
+				bool		eiDelay;		// EI executed, IME is set after the next instruction
+				uint8_t		pending;		// ( IF & IE ) | EI_WAITING
+			};
+
+			Cpu*			_cpu;
+			State*			_state;
+
+			Interrupts ( void );
+			Interrupts ( Interrupts const & src );
+			Interrupts & operator=( Interrupts const & rhs );
+
+		public:
+			Interrupts ( Cpu *cpu );
+			virtual ~Interrupts ( void );
+
+			void			reset ( void );
+
+			void			request ( Interrupt const& interrupt );
+			void			onWriteIF ( uint8_t const& value );
+			void			onWriteIE ( uint8_t const& value );
+
+			void			enable ( void );		// EI
+			void			disable ( void );		// DI
+			void			enableNow ( void );		// RETI
+
+			int				service ( void );
+
+			// hot path, kept inline
+			uint8_t const&	pending ( void ) const { return (_state->pending); }
+			bool const&		ime ( void ) const { return (_state->ime); }
+
+		private:
+			void			_update ( void );
+	};
+}
+
+#else
+namespace Gbmu {
+	class Interrupts;
+}
+#endif // !INTERRUPTS_CLASS_HPP
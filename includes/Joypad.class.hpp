@@ -0,0 +1,79 @@
+#ifndef JOYPAD_CLASS_HPP
+# define JOYPAD_CLASS_HPP
+
+# include <iostream>
+# include <inttypes.h> //Allow uint8_t on Debian
+
+# include "Cpu.class.hpp"
+
+/*
+
+******************************* JOYPAD ***********************************
+
+	-- P1 Register (joypad) [0xFF00]
+		BIT    5: 	select the buttons		( 0 = selected )
+		BIT    4: 	select the directions	( 0 = selected )
+		BITS 0-3: 	lines of the selected keys ( 0 = pressed )
+					buttons:	A		B		Select	Start
+					directions:	Right	Left	Up		Down
+
+	The keys are given as one mask ( Button bits ), the low nibble are the
+	buttons and the high one the directions, so each group is a line set
+	as is. A line falling ( key pressed or group selected ) requests the
+	joypad interrupt.
+
+*/
+
+namespace Gbmu
+{
+	class Joypad
+	{
+		public:
+			enum Button
+			{
+				A = 0x01,
+				B = 0x02,
+				SELECT = 0x04,
+				START = 0x08,
+				RIGHT = 0x10,
+				LEFT = 0x20,
+				UP = 0x40,
+				DOWN = 0x80
+			};
+
+		private:
+			// in the arena
+			struct State
+			{
+				uint8_t		buttons;		// Button mask of the keys pressed
+				uint8_t		select;			// P1 bits 4 - 5
+			};
+
+			Cpu*			_cpu;
+			State*			_state;
+
+			Joypad ( void );
+			Joypad ( Joypad const & src );
+			Joypad & operator=( Joypad const & rhs );
+
+		public:
+			Joypad ( Cpu *cpu );
+			virtual ~Joypad ( void );
+
+			void			reset ( void );
+
+			uint8_t			read ( void ) const;
+			void			write ( uint8_t const& value );
+			void			setButtons ( uint8_t const& buttons );
+			uint8_t const&	buttons ( void ) const;
+
+		private:
+			uint8_t			_lines ( void ) const;		// pressed and selected, 1 = low
+	};
+}
+
+#else
+namespace Gbmu {
+	class Joypad;
+}
+#endif // !JOYPAD_CLASS_HPP
@@ -0,0 +1,111 @@
+#ifndef LOCKSTEP_CLASS_HPP
+# define LOCKSTEP_CLASS_HPP
+
+# include <iostream>
+# include <string>
+# include <inttypes.h> //Allow uint8_t on Debian
+
+# include "Cpu.class.hpp"
+# include "SaveState.class.hpp"
+# include "HashLog.class.hpp"
+
+/*
+
+****************************** LOCKSTEP ***********************************
+
+	Check that the way the machine is driven does not change what a game
+	sees: the same cartridge, states and keys run on two cpus side by
+	side. Both run the same instruction interpreter, only the loop around
+	it, the sound and the rendering differ:
+
+		reference	one instruction at a time ( step ), sound synthesized,
+					lines rendered inline
+		optimized	whole slices ( runFor ), no sound, render thread
+
+	It proves nothing about a faster interpreter until there is one to
+	put on the optimized side.
+
+	Every interval instructions of the reference, the optimized cpu is run
+	up to the same clock and both are compared: clock, registers, HALT,
+	a hash of each page of the live range of their StateArena ( from
+	0x8000 the offset is the address, below are the components state,
+	the registers, palettes and VRAM ) and a hash of their frame buffers,
+	the render thread flushed first.
+	Both are snapshot when they agree. On a difference, they go back to
+	the last snapshots and are compared after every instruction, so the
+	report names the very first instruction that diverged:
+
+		first divergence after 1234567 instructions, cycle 0x5f3a10
+		pc 0x0219: 0xe0 LDH (a8),A
+		              reference    optimized
+		  HL          0xc000       0xc001
+		  page 0xc000 0xc000: 0x00 != 0x3f ( 1 byte )
+		  pixels 12,40: 0xffffffff != 0xff000000 ( 8 pixels )
+
+	The pixels are not part of a state: the frame buffers of the last
+	agreement are kept aside and put back with the snapshots.
+
+*/
+
+# define LOCKSTEP_INTERVAL		1000		// instructions between two comparisons
+# define LOCKSTEP_PAGE_SIZE		0x1000
+# define LOCKSTEP_PAGES			(ARENA_SIZE / LOCKSTEP_PAGE_SIZE)
+# define LOCKSTEP_FIRST_PAGE	(ARENA_LIVE / LOCKSTEP_PAGE_SIZE)
+
+namespace Gbmu
+{
+	class Lockstep
+	{
+		private:
+			Cpu*			_reference;
+			Cpu*			_optimized;
+			size_t			_interval;
+			uint64_t		_instructions;	// run by the reference
+			uint64_t		_checked;		// instructions at the last agreement
+			SaveState		_referenceState;	// both at _checked
+			SaveState		_optimizedState;
+			uint16_t		_pc;			// last instruction run
+			uint8_t			_opcode[2];
+			uint32_t*		_pixels;		// both frame buffers at _checked
+			bool			_halted;		// it was halted instead
+			std::string		_report;
+
+			Lockstep ( Lockstep const & src );
+			Lockstep & operator=( Lockstep const & rhs );
+
+		public:
+			Lockstep ( size_t const& interval = LOCKSTEP_INTERVAL );
+			virtual ~Lockstep ( void );
+
+			// both cpus, from power on or from a state ( a movie start )
+			void				load ( std::string const& cartridgePath, Gb::Model const& model );
+			bool				loadState ( SaveState& state );
+			void				setButtons ( uint8_t const& buttons );
+
+			// false at the first divergence, report() tells it
+			bool				run ( uint64_t const& instructions );
+			bool				runFrame ( void );
+
+			uint64_t const&		instructions ( void ) const;
+			std::string const&	report ( void ) const;
+			Cpu*				reference ( void ) const;
+			Cpu*				optimized ( void ) const;
+
+		private:
+			void				_step ( void );
+			bool				_check ( void );
+			bool				_sync ( void );
+			bool				_same ( void ) const;
+			void				_locate ( void );
+			void				_describe ( void );
+			static uint8_t const*	_page ( Cpu const* cpu, size_t const& page );
+			static size_t			_pageSize ( size_t const& page );
+			static uint32_t const*	_frame ( Cpu* cpu );
+	};
+}
+
+#else
+namespace Gbmu {
+	class Lockstep;
+}
+#endif // !LOCKSTEP_CLASS_HPP
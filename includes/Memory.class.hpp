@@ -6,6 +6,7 @@
 # include <inttypes.h> //Allow uint8_t on Debian
 
 #include "Cpu.class.hpp"
+#include "StateArena.class.hpp"
 
 /*
 
@@ -91,6 +92,16 @@
 	-- OCPD Register (BG Palette write data) [0xFF6B]
 		the value to write in color palette
 
+	Each palette write also refresh one entry of a shadow table of
+	0xAARRGGBB colors ( _bcpRgb / _ocpRgb, 32 colors each ), so the
+	renderer never converts RGB555 colors per pixel.
+
+******************************* STORAGE **********************************
+
+	Every writable byte is in the cpu StateArena, the ROM half of the map
+	is read from the cartridge ( a zeroed bank without one ). ROM writes
+	are dropped until the MBCs are there.
+
 */
 
 # define GB_MEM_SIZE 	0x10000
@@ -103,25 +114,67 @@
 # define VRAM_BANK_SIZE	0x2000
 # define WRAM_BANK_SIZE	0x1000
 
+# define VRAM_ADDR		0x8000
+# define OAM_ADDR		0xFE00
+# define OAM_SIZE		0xA0
+# define IO_ADDR		0xFF00
+
+// I/O registers addresses
+# define IO_P1			0xFF00
+# define IO_DIV			0xFF04
+# define IO_TIMA		0xFF05
+# define IO_TMA			0xFF06
+# define IO_TAC			0xFF07
+# define IO_IF			0xFF0F
+# define IO_NR10		0xFF10
+# define IO_LCDC		0xFF40
+# define IO_STAT		0xFF41
+# define IO_SCY			0xFF42
+# define IO_SCX			0xFF43
+# define IO_LY			0xFF44
+# define IO_LYC			0xFF45
+# define IO_DMA			0xFF46
+# define IO_BGP			0xFF47
+# define IO_OBP0		0xFF48
+# define IO_OBP1		0xFF49
+# define IO_WY			0xFF4A
+# define IO_WX			0xFF4B
+# define IO_VBK			0xFF4F
+# define IO_BCPS		0xFF68
+# define IO_BCPD		0xFF69
+# define IO_OCPS		0xFF6A
+# define IO_OCPD		0xFF6B
+# define IO_IE			0xFFFF
+
+# define PALETTE_COLORS	0x20		// 8 palettes * 4 colors
+
 namespace Gbmu{
 class Memory
 {
 private:
-	uint8_t*		_data; 			// allocated DMG memory map
-	/*NI*/	//uint8_t*		_vram;			// allocated VRAM (max 16KB for CGB)
-	/*NI*/	//uint8_t*		_vramBankPtr;	// pointer to switch banks
+	Cpu*			_cpu;			// owner, used to notify the components on I/O writes
+	uint8_t const*	_rom;			// 0x0000 - 0x7FFF, the cartridge ROM
+	uint8_t*		_data; 			// memory map, valid from 0x8000 ( arena base )
+	uint8_t*		_vram;			// VRAM (max 16KB for CGB)
+	uint8_t*		_vramBankPtr;	// pointer to switch banks
 	/*NI*/	//uint8_t*		_ram;			// allocated RAM (max 32KB for CGB)
 	/*NI*/	//uint8_t*		_ramBankPtr;	// pointer to switch banks
-	/*NI*/	//uint8_t*		_bcp;			// allocated palettes RAM for BG
-	/*NI*/	//uint8_t*		_ocp;			// allocated palettes RAM for OBJ
+	uint8_t*		_bcp;			// palettes RAM for BG
+	uint8_t*		_ocp;			// palettes RAM for OBJ
+	uint32_t*		_bcpRgb;		// BG palettes converted to 0xAARRGGBB
+	uint32_t*		_ocpRgb;		// OBJ palettes converted to 0xAARRGGBB
+
+	Memory(void);					// forbid instanciation without Cpu
 
 public:
-	Memory(void);
+	Memory(Cpu *cpu, StateArena *arena);
 	virtual ~Memory( void );
 	Memory(Memory const & src);
 	Memory & operator=(Memory const & rhs);
 
-	/*NI*/	void			reset ( void );
+	void					reset ( void );
+	void					setRom ( uint8_t const* rom );		// CARTRIDGE_SIZE bytes, NULL for none
+	void					remap ( void );		// the banks after the arena was overwritten
 
 	uint8_t					getByteAt ( uint16_t const& addr ) const;
 	uint16_t				getWordAt ( uint16_t const& addr );
@@ -129,24 +182,30 @@ public:
 	void					setByteAt ( uint16_t const& addr, uint8_t const& value );
 	/*NI*/	void			setWordAt ( uint16_t const& addr, uint16_t const& value );
 
-	/*NI*/	void			onWriteVBK ( uint8_t const& value );
+	void					onWriteDMA ( uint8_t const& value );
+	void					onWriteVBK ( uint8_t const& value );
 	/*NI*/	void			onWriteSVBK ( uint8_t const& value );
-	/*NI*/	void			onWriteBCPS ( uint8_t const& value );
-	/*NI*/	void			onWriteBCPD ( uint8_t const& value );
-	/*NI*/	void			onWriteOCPS ( uint8_t const& value );
-	/*NI*/	void			onWriteOCPD ( uint8_t const& value );
+	void					onWriteBCPS ( uint8_t const& value );
+	void					onWriteBCPD ( uint8_t const& value );
+	void					onWriteOCPS ( uint8_t const& value );
+	void					onWriteOCPD ( uint8_t const& value );
 
 	uint8_t*				data ( void ) const;
-	/*NI*/	uint8_t*		vram ( void ) const;
-	/*NI*/	uint8_t*		vramBankPtr ( void ) const;
+	uint8_t*				vram ( void ) const;
+	uint8_t*				vramBankPtr ( void ) const;
 	/*NI*/	uint8_t*		ram ( void ) const;
 	/*NI*/	uint8_t*		ramBankPtr ( void ) const;
-	/*NI*/	uint8_t*		bcp ( void ) const;
-	/*NI*/	uint8_t*		ocp ( void ) const;
+	uint8_t*				bcp ( void ) const;
+	uint8_t*				ocp ( void ) const;
+	uint32_t const*			bcpRgb ( void ) const;
+	uint32_t const*			ocpRgb ( void ) const;
 
-	/*NI*/	void			saveState ( std::fstream& file );
-	/*NI*/	void			loadState ( std::fstream& file );
+	static uint32_t			rgb555ToArgb ( uint8_t const& lsb, uint8_t const& hsb );
 
+private:
+	uint8_t					_readIO ( uint16_t const& addr ) const;
+	void					_writePalette ( uint16_t const& specs, uint8_t* palette,
+								uint32_t* rgb, uint8_t const& value );
 };
 }
 #else
@@ -0,0 +1,49 @@
+#ifndef MIXER_CLASS_HPP
+# define MIXER_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stddef.h>
+
+# include "IAudioSink.class.hpp"
+
+/*
+
+******************************* MIXER *************************************
+
+	Mix the 4 band-limited channels into 16 bits stereo samples:
+
+		left	= sum( channel * ( NR51 left bit ) ) * ( NR50 left volume + 1 )
+		right	= sum( channel * ( NR51 right bit ) ) * ( NR50 right volume + 1 )
+
+	Both sums are folded into 4 gains per side, updated only when NR50 /
+	NR51 change. With SSE2, 4 samples are mixed at once then saturated,
+	packed and interleaved as L R L R ..
+
+*/
+
+# define MIXER_CHANNELS		4
+# define MIXER_SCALE		64.0f		// 4 channels * 15 * 8 * 64 fits in 16 bits
+
+namespace Gbmu
+{
+	class Mixer
+	{
+		private:
+			float			_left[MIXER_CHANNELS];
+			float			_right[MIXER_CHANNELS];
+
+			Mixer ( Mixer const & src );
+			Mixer & operator=( Mixer const & rhs );
+
+		public:
+			Mixer ( void );
+			virtual ~Mixer ( void );
+
+			void			setGains ( uint8_t const& nr50, uint8_t const& nr51, bool const& muted );
+
+			// channels[c] holds count samples, count rounded up to 4 must fit in them
+			void			mix ( float const* const* channels, AudioSample *out, size_t const& count ) const;
+	};
+}
+
+#endif // !MIXER_CLASS_HPP
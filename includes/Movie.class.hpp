@@ -0,0 +1,98 @@
+#ifndef MOVIE_CLASS_HPP
+# define MOVIE_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stddef.h>
+# include <string>
+# include <vector>
+
+# include "SaveState.class.hpp"
+
+/*
+
+******************************* MOVIE ************************************
+
+	A run replayed bit for bit: the state it starts from, then the keys
+	of every frame. The emulation is deterministic, the same state fed
+	the same keys at the same frames always gives the same run.
+
+		+------------------------------------+
+		| "GBMV"  format  0                  |	file header, 24 bytes
+		| rom hash                           |	HashLog::hash of the whole ROM
+		| frames  state size                 |
+		+------------------------------------+
+		| save state                         |	where the run starts
+		+------------------------------------+
+		| keys of frame 0, 1, ..             |	one Joypad::Button mask each
+		+------------------------------------+
+
+	While recording or playing, input() is called once per frame with the
+	live keys and returns the ones to press: a push or a read, nothing
+	else. The whole file is written and read at once.
+
+*/
+
+# define MOVIE_MAGIC		"GBMV"
+# define MOVIE_FORMAT		1
+# define MOVIE_HEADER_SIZE	24
+
+namespace Gbmu
+{
+	class Movie
+	{
+		public:
+			enum Mode
+			{
+				NONE,
+				RECORD,
+				PLAY
+			};
+
+		private:
+			Mode					_mode;
+			uint64_t				_romHash;
+			SaveState				_state;		// initial state
+			std::vector<uint8_t>	_inputs;	// keys of each frame
+			size_t					_frame;		// next frame played
+
+			Movie ( Movie const & src );
+			Movie & operator=( Movie const & rhs );
+
+		public:
+			Movie ( void );
+			virtual ~Movie ( void );
+
+			// fill state() first, then record from it
+			void				record ( uint64_t const& romHash );
+			void				play ( void );		// a movie loaded, from its first frame
+			void				stop ( void );
+
+			bool				save ( std::string const& path ) const;
+			bool				load ( std::string const& path );
+
+			Mode const&			mode ( void ) const;
+			uint64_t const&		romHash ( void ) const;
+			SaveState&			state ( void );
+			size_t				frames ( void ) const;
+
+			// keys of the next frame, live is the keys held by the player
+			uint8_t				input ( uint8_t const& live )
+			{
+				if (_mode == PLAY)
+				{
+					if (_frame + 1 >= _inputs.size())
+						_mode = NONE;		// the last one, back to the player after it
+					return (_inputs[_frame++]);
+				}
+				else if (_mode == RECORD)
+					_inputs.push_back(live);
+				return (live);
+			}
+	};
+}
+
+#else
+namespace Gbmu {
+	class Movie;
+}
+#endif // !MOVIE_CLASS_HPP
@@ -0,0 +1,107 @@
+#ifndef MPSCQUEUE_CLASS_HPP
+# define MPSCQUEUE_CLASS_HPP
+
+# include <atomic>
+# include <cstddef>
+
+/*
+
+********************** MULTI PRODUCER / SINGLE CONSUMER QUEUE *************
+
+	Fixed size lock-free queue used to send commands to a thread.
+	Any thread may push, only one thread may pop.
+
+	SIZE cells are allocated once, each one with a sequence number telling
+	whose turn it is: a producer claims the next cell with one compare and
+	swap on head, writes its value then publishes it through the sequence.
+	Producers never wait for each other nor for the consumer, push only
+	fails on a full queue.
+
+		sequence == position		free, the producer at position writes it
+		sequence == position + 1	written, the consumer reads it
+		sequence == position + SIZE	read, free for the next round
+
+	The values are assigned, never constructed: a cell keeps the capacity
+	of its strings and vectors, no push allocates once they are large
+	enough. SIZE must be a power of 2.
+
+*/
+
+namespace Gbmu
+{
+	template <typename T, size_t SIZE>
+	class MpscQueue
+	{
+		private:
+			struct Cell
+			{
+				std::atomic<size_t>	sequence;
+				T					value;
+			};
+
+			Cell*					_cells;
+			std::atomic<size_t>		_head;		// next cell to claim (producers)
+			size_t					_tail;		// next cell to read (consumer only)
+
+			MpscQueue(MpscQueue const & src);
+			MpscQueue & operator=(MpscQueue const & rhs);
+
+		public:
+			MpscQueue(void) : _cells(new Cell[SIZE]), _head(0), _tail(0)
+			{
+				static_assert((SIZE & (SIZE - 1)) == 0, "MpscQueue size must be a power of 2");
+				for (size_t i = 0; i < SIZE; i++)
+					_cells[i].sequence.store(i, std::memory_order_relaxed);
+			}
+
+			virtual ~MpscQueue(void)
+			{
+				delete[] _cells;
+			}
+
+			/*
+			** Producer side, any thread, return false if the queue is full
+			*/
+			bool		push ( T const& value )
+			{
+				size_t	pos = _head.load(std::memory_order_relaxed);
+				Cell*	cell;
+				size_t	sequence;
+
+				while (true)
+				{
+					cell = &_cells[pos & (SIZE - 1)];
+					sequence = cell->sequence.load(std::memory_order_acquire);
+					if (sequence == pos)
+					{
+						if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+							break ;
+					}
+					else if (sequence < pos)
+						return (false);
+					else
+						pos = _head.load(std::memory_order_relaxed);
+				}
+				cell->value = value;
+				cell->sequence.store(pos + 1, std::memory_order_release);
+				return (true);
+			}
+
+			/*
+			** Consumer side, return false if nothing is published yet
+			*/
+			bool		pop ( T& value )
+			{
+				Cell*	cell = &_cells[_tail & (SIZE - 1)];
+
+				if (cell->sequence.load(std::memory_order_acquire) != _tail + 1)
+					return (false);
+				value = cell->value;
+				cell->sequence.store(_tail + SIZE, std::memory_order_release);
+				_tail++;
+				return (true);
+			}
+	};
+}
+
+#endif // !MPSCQUEUE_CLASS_HPP
@@ -0,0 +1,245 @@
+#ifndef PPU_CLASS_HPP
+# define PPU_CLASS_HPP
+
+# include <iostream>
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <cstring>
+# include <algorithm>
+# include <atomic>
+# include <thread>
+# include <mutex>
+# include <condition_variable>
+
+# include "Cpu.class.hpp"
+# include "IScreen.class.hpp"
+# include "SpscRing.class.hpp"
+# include "HashLog.class.hpp"
+# include "Scheduler.class.hpp"
+
+/*
+
+************************** PPU TIMING (1 LINE) ****************************
+
+	One line takes 456 clock cycles, one frame takes 154 lines ( 70224 cycles )
+
+	0			80					252							456
+	+-----------+-------------------+---------------------------+
+	|  MODE 2	|	MODE 3			|	MODE 0 ( HBLANK )		|	LY 0 - 143
+	|  OAM scan	|	pixel transfer	|							|
+	+-----------+-------------------+---------------------------+
+	|					MODE 1 ( VBLANK )						|	LY 144 - 153
+	+-----------------------------------------------------------+
+
+	The line is drawn at the start of mode 3 with the registers values
+	of that moment, so HBLANK writes apply to the next line.
+	Each mode end is a Scheduler::PPU event, the ppu is never stepped.
+
+************************** RENDER MODES ***********************************
+
+	-- Inline
+		The line is rendered by the cpu thread as soon as it is reached.
+
+	-- Threaded
+		The cpu thread only records a LineState per line plus every
+		VRAM/OAM/palette write in a lock-free ring ( the log ).
+		A render thread replays that log on its own copy of VRAM/OAM/palettes
+		and calls the same renderLine, so pixels are identical to inline.
+
+		cpu thread  --[ VRAM/OAM/palette write | LINE state | FRAME ]-->  render thread
+
+		Neither side spins: an empty log puts the render thread to sleep
+		until the next FRAME / STOP, or until PPU_LOG_WAKE entries wait
+		( it then draws a whole frame per wake up, one frame behind ).
+		The cpu thread sleeps on a full log and in sync() until the render
+		thread completed a frame or drained the log. Each side checks the
+		other's flag after a fence, so a wake up is never lost and no lock
+		is taken while both are busy: two wake ups per frame at most.
+
+		The pixels belong to the render thread until it is idle on an
+		empty log: flush() waits for it. A restore flushes, overwrites the
+		memory the log was about and copies it to the sleeping thread,
+		which is only restarted when the CGB rendering changed.
+
+************************** SPRITES ***************************************
+
+	The OBJ of each line are kept in a SpriteIndex, rebuilt only after
+	an OAM write ( direct or DMA ) or an OBJ size change:
+
+		line 0	| count | OAM indexes in priority order ( max 10 ) |
+		...
+		line 143| count | ... |
+
+	Selection: the first 10 OBJ in OAM order covering the line.
+	Priority:	DMG - lowest X first, then lowest OAM index
+				CGB - lowest OAM index first
+
+************************** COLORS ****************************************
+
+	DMG: BGP/OBP0/OBP1 shades are resolved once per line.
+	CGB: colors come from the Memory shadow tables already in 0xAARRGGBB,
+		a mid-frame palette write is seen by the next drawn line.
+
+*/
+
+# define LINE_CYCLES		456
+# define OAM_CYCLES			80
+# define TRANSFER_CYCLES	172
+# define VISIBLE_LINES		144
+# define FRAME_LINES		154
+
+# define PPU_LOG_SIZE		0x10000		// entries in the render log ( must be a power of 2 )
+# define PPU_LOG_WAKE		(PPU_LOG_SIZE / 4)	// a sleeping render thread is woken past this
+
+namespace Gbmu
+{
+	class Ppu
+	{
+		public:
+			// PPU registers as seen at the start of mode 3 of one line
+			struct LineState
+			{
+				uint8_t		lcdc;
+				uint8_t		scy;
+				uint8_t		scx;
+				uint8_t		wy;
+				uint8_t		wx;
+				uint8_t		bgp;
+				uint8_t		obp0;
+				uint8_t		obp1;
+				uint8_t		ly;
+				uint8_t		windowLine;		// internal window line counter
+			};
+
+			// visible OBJ of each line, in priority order
+			struct SpriteIndex
+			{
+				uint8_t				count[VISIBLE_LINES];
+				uint8_t				list[VISIBLE_LINES][10];
+				uint8_t				height;		// OBJ height the index was built for
+				bool				color;		// CGB priority the index was built for
+				bool				dirty;		// OAM changed since the last build
+			};
+
+			// memory read by renderLine
+			struct Source
+			{
+				uint8_t const*		vram;		// VRAM_SIZE bytes ( bank 0 then bank 1 )
+				uint8_t const*		oam;		// OAM_SIZE bytes
+				uint32_t const*		bgRgb;		// CGB BG colors
+				uint32_t const*		objRgb;		// CGB OBJ colors
+				bool				color;		// CGB rendering
+				SpriteIndex*		sprites;	// index of src.oam, rebuilt on demand
+			};
+
+		private:
+			enum LogType
+			{
+				LOG_VRAM,
+				LOG_OAM,
+				LOG_BCP,
+				LOG_OCP,
+				LOG_LINE,
+				LOG_FRAME,
+				LOG_STOP
+			};
+
+			struct LogEntry
+			{
+				uint8_t		type;			// LogType
+				uint8_t		value;			// written value ( LOG_VRAM, LOG_OAM, LOG_BCP, LOG_OCP )
+				uint16_t	addr;			// VRAM offset, OAM address or palette index
+				LineState	line;			// line registers ( LOG_LINE )
+			};
+
+			typedef SpscRing<LogEntry, PPU_LOG_SIZE>	Log;
+
+			// in the arena, the pixels are not state: they are drawn again
+			struct State
+			{
+				uint64_t	lineStart;		// cycle the current line started at
+				uint64_t	frame;			// frames completed by the cpu side
+				uint8_t		mode;			// current STAT mode
+				uint8_t		ly;				// current line
+				uint8_t		windowLine;		// window lines drawn in this frame
+				bool		color;			// CGB rendering
+			};
+
+			Cpu*					_cpu;
+			State*					_state;
+			IScreen*				_screen;		// who receive completed frames
+			HashLog*				_hashLog;		// optional hash of each completed frame
+			uint32_t*				_pixels;		// SCREEN_WIDTH * SCREEN_HEIGHT frame buffer
+			SpriteIndex				_sprites;		// inline rendering OBJ index
+
+			bool					_threaded;		// render thread flag
+			std::thread*			_thread;		// render thread
+			Log*					_log;			// cpu thread -> render thread log
+			uint8_t*				_threadVram;	// render thread VRAM copy
+			uint8_t*				_threadOam;		// render thread OAM copy
+			uint8_t*				_threadBcp;		// render thread palettes copy ( BG then OBJ )
+			uint32_t*				_threadRgb;		// render thread converted colors ( BG then OBJ )
+			SpriteIndex				_threadSprites;	// render thread OBJ index
+			bool					_threadColor;	// CGB rendering of the render thread
+			std::atomic<uint64_t>	_framesRendered;// frames completed by the render thread
+			std::mutex				_lock;			// sleeping side
+			std::condition_variable	_work;			// log filled ( render thread waits )
+			std::condition_variable	_progress;		// frame completed or log drained ( cpu thread waits )
+			std::atomic<bool>		_idle;			// render thread sleeps on an empty log
+			std::atomic<bool>		_waiting;		// cpu thread sleeps on _progress
+
+			Ppu ( void );
+			Ppu ( Ppu const & src );
+			Ppu & operator=( Ppu const & rhs );
+
+		public:
+			Ppu ( Cpu *cpu );
+			virtual ~Ppu ( void );
+
+			void				reset ( void );
+			void				onRestore ( void );		// the arena was overwritten, after flush()
+
+			void				onWriteVram ( uint16_t const& addr, uint8_t const& value );
+			void				onWriteOam ( uint16_t const& addr, uint8_t const& value );
+			void				onWritePalette ( bool const& obj, uint8_t const& index, uint8_t const& value );
+
+			void				setScreen ( IScreen* screen );
+			void				setHashLog ( HashLog* log );
+			void				setThreaded ( bool const& b );
+			bool				threaded ( void ) const;
+			void				setColor ( bool const& b );
+			bool				color ( void ) const;
+			void				sync ( void );
+			void				flush ( void );		// the render thread is done with the log
+
+			uint64_t			frame ( void ) const;
+			uint8_t				ly ( void ) const;
+			uint32_t const*		frameBuffer ( void );
+			void				setFrameBuffer ( uint32_t const* pixels );	// after flush(), the pixels are not state
+
+			static void			renderLine ( LineState const& state, Source const& src, uint32_t* line );
+			static void			buildSpriteIndex ( SpriteIndex& index, uint8_t const* oam,
+									uint8_t const& height, bool const& color );
+
+		private:
+			static void			_onEvent ( void *owner, uint64_t const& when );
+			void				_drawLine ( void );
+			void				_nextLine ( void );
+			void				_endFrame ( void );
+			void				_frameRendered ( uint64_t const& frame );
+			void				_setMode ( uint8_t const& mode );
+			void				_copyMemory ( void );
+			void				_post ( LogEntry const& entry );
+			void				_wait ( bool (Ppu::*done)( void ) const );
+			void				_notify ( void );
+			bool				_hasRoom ( void ) const;
+			bool				_caughtUp ( void ) const;
+			bool				_drained ( void ) const;
+			void				_renderLoop ( void );
+	};
+}
+
+#else
+namespace Gbmu {
+	class Ppu;
+}
+#endif // !PPU_CLASS_HPP
@@ -0,0 +1,108 @@
+#ifndef REWIND_CLASS_HPP
+# define REWIND_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stddef.h>
+
+# include "SaveState.class.hpp"
+# include "StateCodec.class.hpp"
+
+/*
+
+******************************* REWIND *************************************
+
+	History of snapshots in a fixed size ring of memory.
+
+	Two states a few frames apart differ in a few bytes: each capture is
+	stored as ( state XOR previous state ), mostly zeros, run length coded:
+
+		[ zeros: varint ] [ literals: varint ] [ literal bytes ] ..
+
+	With LZ4 built in ( StateCodec ), an entry is then packed with it
+	when that makes it smaller: keyframes mostly, a delta of a few dozen
+	bytes stays as it is.
+
+	Every REWIND_KEYFRAME captures, a keyframe ( the state XOR nothing )
+	starts a new chain. Any state is rebuilt from the keyframe before it,
+	applying the deltas of its chain only:
+
+		K d d d d K d d d d K d d
+		^				  ^
+		|_________________| state 8 = K5 ^ d6 ^ d7 ^ d8
+
+	Stepping back from the newest state needs no chain at all: the
+	newest delta XOR the newest state is the one before.
+
+	Entries are written one after another in the ring, wrapping to its
+	start. When a new entry needs room the oldest chain ( keyframe and its
+	deltas ) is dropped as a whole, the memory used never grows.
+
+	A capture ( Cpu::saveState and push ) costs about 1% of the time the
+	emulation of a frame takes, every REWIND_INTERVAL frames: far below
+	the 5% budget, and a small fraction of a frame played at full speed.
+
+*/
+
+# define REWIND_MEMORY		(64 << 20)	// 64 MB ring
+# define REWIND_INTERVAL	4			// frames between captures
+# define REWIND_KEYFRAME	32			// captures per chain
+# define REWIND_ENTRIES		0x10000		// max captures kept
+
+namespace Gbmu
+{
+	class Rewind
+	{
+		private:
+			struct Entry
+			{
+				size_t		offset;		// in the ring
+				size_t		size;
+				size_t		raw;		// run length coded size, 0 if not packed
+				bool		keyframe;
+			};
+
+			uint8_t*		_ring;
+			size_t			_capacity;
+			Entry*			_entries;		// circular, oldest at _first
+			size_t			_first;
+			size_t			_count;
+			size_t			_used;			// bytes of the live entries
+			size_t			_sinceKeyframe;
+			uint8_t*		_state;			// newest state, raw
+			size_t			_stateSize;
+			uint8_t*		_scratch;		// coding buffer
+			uint8_t*		_packed;		// LZ4 side of the coding
+			bool			_pack;			// LZ4 is built in
+
+			Rewind ( Rewind const & src );
+			Rewind & operator=( Rewind const & rhs );
+
+		public:
+			Rewind ( size_t const& memory = REWIND_MEMORY );
+			virtual ~Rewind ( void );
+
+			void			clear ( void );
+			void			push ( SaveState const& state );
+			bool			back ( SaveState& state );	// drop the newest, state is the one before
+			bool			at ( size_t const& age, SaveState& state );	// 0 is the newest, nothing dropped
+
+			size_t const&	count ( void ) const;
+			size_t const&	used ( void ) const;		// bytes
+
+		private:
+			Entry&			_entry ( size_t const& age );
+			void			_dropOldest ( void );
+			bool			_overlaps ( size_t const& offset, size_t const& size );
+			bool			_store ( size_t const& coded, bool const& keyframe );
+			void			_apply ( Entry const& entry, uint8_t* state );
+			void			_resize ( size_t const& size );
+			static size_t	_encode ( uint8_t const* a, uint8_t const* b, size_t const& size, uint8_t* out );
+			static void		_apply ( uint8_t const* in, size_t const& size, uint8_t* state );
+	};
+}
+
+#else
+namespace Gbmu {
+	class Rewind;
+}
+#endif // !REWIND_CLASS_HPP
@@ -0,0 +1,94 @@
+#ifndef SAVESTATE_CLASS_HPP
+# define SAVESTATE_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stddef.h>
+# include <string>
+
+/*
+
+***************************** SAVE STATE ***********************************
+
+	Whole machine state as tagged chunks, built in one preallocated buffer
+	then written with a single write ( read back with a single read ).
+
+		+------------------------------------+
+		| "GBMS"  format  0  size            |	file header, 12 bytes
+		+------------------------------------+
+		| "CART"  version  0  size | payload |	chunk header, 12 bytes
+		| "ARNA"  version  0  size | payload |
+		| ..                                 |
+		+------------------------------------+
+
+	Each writer puts its own chunk ( begin, put / write, end ) and finds
+	it back by tag when loading. The size prefix lets a reader skip the
+	chunks it does not know ( "META" for the cpu ), the chunk version
+	tells one layout from another. A machine is two chunks: "CART", the
+	identity of its game, and "ARNA", its whole state ( see StateArena ).
+
+	Values are raw, in host order ( little endian ). The buffer only grows,
+	saving again and again never allocates once it is large enough.
+
+*/
+
+# define SAVESTATE_MAGIC		"GBMS"
+# define SAVESTATE_FORMAT		1
+# define SAVESTATE_CAPACITY		0x40000		// 256 KB, a whole DMG state fits
+# define SAVESTATE_HEADER_SIZE	12
+
+namespace Gbmu
+{
+	class SaveState
+	{
+		private:
+			uint8_t*		_buffer;
+			size_t			_capacity;
+			size_t			_size;			// bytes used
+			size_t			_chunk;			// open chunk header ( writing )
+			size_t			_pos;			// read position ( reading )
+			size_t			_end;			// end of the chunk found ( reading )
+			uint16_t		_version;		// version of the chunk found
+
+			SaveState ( SaveState const & src );
+			SaveState & operator=( SaveState const & rhs );
+
+		public:
+			SaveState ( size_t const& capacity = SAVESTATE_CAPACITY );
+			virtual ~SaveState ( void );
+
+			// writing
+			void			clear ( void );		// empty state, file header only
+			void			begin ( char const* tag, uint16_t const& version );
+			void			write ( void const* data, size_t const& size );
+			void			end ( void );
+			bool			save ( std::string const& path ) const;
+
+			template <typename T>
+			void			put ( T const& value ) { this->write(&value, sizeof(T)); }
+
+			// reading, false on a bad header or past the end of the chunk
+			bool			load ( std::string const& path );
+			bool			assign ( uint8_t const* data, size_t const& size );
+			bool			find ( char const* tag );
+			uint16_t const&	version ( void ) const;
+			bool			read ( void* data, size_t const& size );
+			bool			skip ( size_t const& size );
+			size_t			remaining ( void ) const;		// bytes left in the chunk found
+
+			template <typename T>
+			bool			get ( T& value ) { return (this->read(&value, sizeof(T))); }
+
+			uint8_t const*	data ( void ) const;
+			size_t const&	size ( void ) const;
+
+		private:
+			void			_reserve ( size_t const& size );
+			bool			_check ( void ) const;
+	};
+}
+
+#else
+namespace Gbmu {
+	class SaveState;
+}
+#endif // !SAVESTATE_CLASS_HPP
@@ -0,0 +1,106 @@
+#ifndef SCHEDULER_CLASS_HPP
+# define SCHEDULER_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stdint.h>
+# include <stddef.h>
+
+# include "StateArena.class.hpp"
+
+/*
+
+***************************** SCHEDULER ************************************
+
+	Global clock of the gameboy in clock cycles ( T-cycles ) since power on,
+	and the next event of every component, kept in a min-heap.
+
+	The cpu runs instructions until the earliest deadline, then the due
+	events are dispatched in time order. Components are never polled
+	after each instruction, they schedule their own next event
+	( next PPU mode, timer overflow, .. ) and reschedule it when a register
+	write changes it.
+
+		now				deadline
+		 v					v
+	-----+------------------+--------------+-----------> cycles
+		 cpu runs here		PPU event		TIMER event
+
+	One event per component can be pending, scheduling it again moves it.
+
+*/
+
+# define NO_DEADLINE	UINT64_MAX
+
+namespace Gbmu
+{
+	class Scheduler
+	{
+		public:
+			enum Event
+			{
+				PPU,			// next PPU mode change
+				TIMER,			// next TIMA overflow
+				APU,			// next frame sequencer step
+				EVENT_COUNT
+			};
+
+			// when is the time the event was scheduled for ( now may be later )
+			typedef void	(*Handler)(void *owner, uint64_t const& when);
+
+		private:
+			struct Entry
+			{
+				uint64_t	when;
+				Event		event;
+			};
+
+			// in the arena, the handlers are not state
+			struct State
+			{
+				uint64_t	now;						// cycles since power on
+				uint64_t	deadline;					// earliest pending event
+				Entry		heap[EVENT_COUNT];			// min-heap on when
+				int			size;
+				int			pos[EVENT_COUNT];			// heap index of each event, -1 if not pending
+			};
+
+			State*			_state;
+			Handler			_handlers[EVENT_COUNT];
+			void*			_owners[EVENT_COUNT];
+
+			Scheduler ( void );
+			Scheduler ( Scheduler const & src );
+			Scheduler & operator=( Scheduler const & rhs );
+
+		public:
+			Scheduler ( StateArena *arena );
+			virtual ~Scheduler ( void );
+
+			void			reset ( void );
+			void			setHandler ( Event const& event, Handler handler, void *owner );
+
+			void			schedule ( Event const& event, uint64_t const& when );
+			void			cancel ( Event const& event );
+			bool			pending ( Event const& event ) const;
+			uint64_t		when ( Event const& event ) const;
+			void			dispatch ( void );
+
+			// hot path, kept inline
+			uint64_t const&	now ( void ) const { return (_state->now); }
+			uint64_t const&	deadline ( void ) const { return (_state->deadline); }
+			void			advance ( size_t const& cycles ) { _state->now += cycles; }
+			void			advanceTo ( uint64_t const& when ) { if (when > _state->now) _state->now = when; }
+
+		private:
+			void			_swap ( int const& a, int const& b );
+			void			_up ( int i );
+			void			_down ( int i );
+			void			_remove ( int const& i );
+	};
+}
+
+#else
+namespace Gbmu {
+	class Scheduler;
+}
+#endif // !SCHEDULER_CLASS_HPP
@@ -0,0 +1,105 @@
+#ifndef SPSCRING_CLASS_HPP
+# define SPSCRING_CLASS_HPP
+
+# include <atomic>
+# include <cstddef>
+
+/*
+
+********************** SINGLE PRODUCER / SINGLE CONSUMER RING *************
+
+	Fixed size lock-free ring used to hand data from one thread to another.
+	Only one thread may push and only one thread may pop.
+
+	SIZE must be a power of 2, head and tail are free running counters
+	and are masked on access.
+
+			 tail (consumer)			head (producer)
+				 v						  v
+	+---+---+---+---+---+---+---+---+---+---+---+---+
+	|	|	|	| x | x | x | x | x |	|	|	|	|
+	+---+---+---+---+---+---+---+---+---+---+---+---+
+
+*/
+
+namespace Gbmu
+{
+	template <typename T, size_t SIZE>
+	class SpscRing
+	{
+		private:
+			T						_buffer[SIZE];	// ring storage
+			std::atomic<size_t>		_head;			// next slot to write (producer only)
+			std::atomic<size_t>		_tail;			// next slot to read (consumer only)
+
+			SpscRing(SpscRing const & src);
+			SpscRing & operator=(SpscRing const & rhs);
+
+		public:
+			SpscRing(void) : _head(0), _tail(0)
+			{
+				static_assert((SIZE & (SIZE - 1)) == 0, "SpscRing size must be a power of 2");
+			}
+
+			/*
+			** Producer side, return false if the ring is full
+			*/
+			bool		push ( T const& value )
+			{
+				size_t	head = _head.load(std::memory_order_relaxed);
+
+				if (head - _tail.load(std::memory_order_acquire) == SIZE)
+					return (false);
+				_buffer[head & (SIZE - 1)] = value;
+				_head.store(head + 1, std::memory_order_release);
+				return (true);
+			}
+
+			/*
+			** Producer side, push as many of count values as fit, return how many
+			** were pushed ( published at once )
+			*/
+			size_t		push ( T const* values, size_t const& count )
+			{
+				size_t	head = _head.load(std::memory_order_relaxed);
+				size_t	room = SIZE - (head - _tail.load(std::memory_order_acquire));
+				size_t	n = count < room ? count : room;
+
+				for (size_t i = 0; i < n; i++)
+					_buffer[(head + i) & (SIZE - 1)] = values[i];
+				_head.store(head + n, std::memory_order_release);
+				return (n);
+			}
+
+			/*
+			** Consumer side, return false if the ring is empty
+			*/
+			bool		pop ( T& value )
+			{
+				size_t	tail = _tail.load(std::memory_order_relaxed);
+
+				if (tail == _head.load(std::memory_order_acquire))
+					return (false);
+				value = _buffer[tail & (SIZE - 1)];
+				_tail.store(tail + 1, std::memory_order_release);
+				return (true);
+			}
+
+			size_t		size ( void ) const
+			{
+				return (_head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire));
+			}
+
+			bool		empty ( void ) const { return (this->size() == 0); }
+			size_t		capacity ( void ) const { return (SIZE); }
+
+			// only safe when neither side is running
+			void		clear ( void )
+			{
+				_head.store(0, std::memory_order_relaxed);
+				_tail.store(0, std::memory_order_relaxed);
+			}
+	};
+}
+
+#endif // !SPSCRING_CLASS_HPP
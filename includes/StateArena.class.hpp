@@ -0,0 +1,107 @@
+#ifndef STATEARENA_CLASS_HPP
+# define STATEARENA_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stddef.h>
+
+# include "SaveState.class.hpp"
+
+/*
+
+***************************** STATE ARENA **********************************
+
+	The whole machine state in one block, aligned on cache lines, so the
+	hot loop touches one region and a snapshot is a single copy: every
+	component keeps its fields in a plain State struct placed in its own
+	slot, the cpu registers and the writable memory follow. The ROM is
+	never in it: the cartridge keeps it, read only. There is no memory
+	bank controller yet, the cartridge RAM is the 0xA000 window.
+
+		offset
+		0x0000	never used
+		0x5B80	Cpu				( BOOT, HALT )
+		0x5BC0	Joypad			( keys, P1 select )
+		0x5C00	Interrupts		( IF, IE, IME, EI delay )
+		0x5C40	Timer			( DIV base, TIMA, TMA, TAC )
+		0x5C80	Ppu				( line, mode, LY, window line, frame, CGB )
+		0x5CC0	Scheduler		( clock, pending events, 0x80 )
+		0x5D40	Apu				( registers, channels, sequencer, 0x100 )
+		0x5E40	Registers
+		0x5E80	BG palettes RAM			( BCP, 0x40 )
+		0x5EC0	OBJ palettes RAM		( OCP, 0x40 )
+		0x5F00	BG palettes 0xAARRGGBB	( 0x80 )
+		0x5F80	OBJ palettes 0xAARRGGBB	( 0x80 )
+		0x6000	VRAM bank 0				( 0x2000 )
+		0x8000	VRAM bank 1				( 0x2000 )
+		0xA000	0xA000 - 0xFFFF			( cartridge RAM, WRAM, OAM, I/O, HRAM, IE )
+
+	The upper half is laid out at its own address: Memory indexes the
+	arena base with the gb address. 0x8000 - 0x9FFF is never reached that
+	way ( VRAM goes through the bank pointer ), so it holds bank 1, and
+	the rest of the state is packed right below it. Only the live range,
+	ARENA_LIVE to the end, is saved and compared.
+
+	Nothing else is state: pointers, handlers, the render thread and the
+	frame buffer stay in the components, and what they derive from their
+	State ( the VRAM bank pointer, the sound filters ) is rebuilt by their
+	onRestore after the arena was overwritten. A saved state is the "ARNA"
+	chunk, the live range as is.
+
+	The arena is its own anonymous mapping, page aligned. share() writes
+	it once in an unlinked file, attach() maps that file over another
+	arena, privately: the branches of a fork read the same pages until
+	one of them writes a page, which the kernel then copies for it alone.
+	The hot loop never checks anything for that.
+
+*/
+
+# define ARENA_SIZE			0x10000
+# define ARENA_LIVE			0x5B80		// first offset in use
+# define ARENA_CPU			0x5B80
+# define ARENA_JOYPAD		0x5BC0
+# define ARENA_INTERRUPTS	0x5C00
+# define ARENA_TIMER		0x5C40
+# define ARENA_PPU			0x5C80
+# define ARENA_SCHEDULER	0x5CC0
+# define ARENA_APU			0x5D40
+# define ARENA_REGISTERS	0x5E40
+# define ARENA_BCP			0x5E80
+# define ARENA_OCP			0x5EC0
+# define ARENA_BCP_RGB		0x5F00
+# define ARENA_OCP_RGB		0x5F80
+# define ARENA_VRAM			0x6000
+# define ARENA_MAP			0x8000		// first address in the arena
+
+namespace Gbmu
+{
+	class StateArena
+	{
+		private:
+			uint8_t*		_base;
+
+			StateArena ( StateArena const & src );
+			StateArena & operator=( StateArena const & rhs );
+
+		public:
+			StateArena ( void );		// zeroed
+			virtual ~StateArena ( void );
+
+			uint8_t*		base ( void ) const;
+
+			template <typename T>
+			T*				at ( size_t const& offset ) const { return (reinterpret_cast<T*>(_base + offset)); }
+
+			void			saveState ( SaveState& state ) const;
+			bool			loadState ( SaveState& state );
+
+			// copy on write: an unlinked file of the arena ( -1 on failure, to close )
+			int				share ( void ) const;
+			bool			attach ( int const& fd );
+	};
+}
+
+#else
+namespace Gbmu {
+	class StateArena;
+}
+#endif // !STATEARENA_CLASS_HPP
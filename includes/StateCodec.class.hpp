@@ -0,0 +1,107 @@
+#ifndef STATECODEC_CLASS_HPP
+# define STATECODEC_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stddef.h>
+# include <string>
+
+# include "SaveState.class.hpp"
+# include "ThreadPool.class.hpp"
+
+/*
+
+***************************** STATE CODEC **********************************
+
+	Compressed save state files, the codec is chosen per call:
+
+		ZLIB	deflate, everywhere
+		LZ4		fast, for states saved often ( autosaves, batches )
+		ZSTD	dense, for states kept for long ( archives )
+
+	Each one is built in on demand ( make ZLIB=1 LZ4=1 ZSTD=1, or qmake
+	CONFIG+=zlib lz4 zstd ), available() tells which ones are there.
+
+	-- File
+		Still a state file: the header and the "META" chunk are kept as
+		they are ( StateIndex::peek and the index work unchanged ), every
+		other chunk is compressed into a single "PACK" chunk:
+
+			+------------------------------------+
+			| "GBMS"  format  0  size            |	file header
+			| "META"  1  0  size | Info          |	as saved
+			| "PACK"  1  0  size                 |
+			| codec  0  raw size                 |	8 bytes
+			| compressed "CART" "ARNA"           |
+			+------------------------------------+
+
+		The chunks are streamed through the codec one after the other and
+		written by blocks of STATECODEC_BLOCK bytes: the compressed state
+		is never whole in memory. load() reads both kinds of files, a
+		packed one is refused past STATECODEC_MAX_RAW bytes once unpacked.
+
+	-- Buffer
+		pack() and unpack() code a whole buffer in memory at once, no
+		header of their own ( Rewind packs its entries that way ).
+
+	-- Batch
+		saveBatch() compresses many states at once, one job per state on
+		a ThreadPool, and returns once they are all written ( Gbmu --pack
+		recompresses state files that way ).
+
+*/
+
+# define STATECODEC_TAG			"PACK"
+# define STATECODEC_VERSION		1
+# define STATECODEC_BLOCK		0x10000		// output written by 64 KB
+# define STATECODEC_MAX_RAW		0x1000000	// 16 MB, far above any state
+
+namespace Gbmu
+{
+	class StateCodec
+	{
+		public:
+			enum Codec
+			{
+				NONE,
+				ZLIB,
+				LZ4,
+				ZSTD
+			};
+
+			struct Job
+			{
+				SaveState const*	state;
+				std::string			path;
+				Codec				codec;
+				int					level;		// 0: the codec default
+				bool				ok;			// set by saveBatch
+			};
+
+		private:
+			StateCodec ( void );
+			StateCodec ( StateCodec const & src );
+			StateCodec & operator=( StateCodec const & rhs );
+			virtual ~StateCodec ( void );
+
+		public:
+			static bool			available ( Codec const& codec );
+			static char const*	name ( Codec const& codec );
+			static bool			parse ( std::string const& name, Codec& codec );
+
+			// level 0: the codec default, NONE is a plain SaveState::save
+			static bool			save ( SaveState const& state, std::string const& path,
+									Codec const& codec, int const& level = 0 );
+			// packed or not, false if the codec is not built in
+			static bool			load ( SaveState& state, std::string const& path );
+			// the packed size, 0 on failure or if it does not fit in capacity
+			static size_t		pack ( Codec const& codec, uint8_t const* src, size_t const& size,
+									uint8_t* dst, size_t const& capacity, int const& level = 0 );
+			// raw is the size once unpacked, exactly
+			static bool			unpack ( Codec const& codec, uint8_t const* src, size_t const& size,
+									uint8_t* dst, size_t const& raw );
+			// number of jobs that failed
+			static size_t		saveBatch ( Job *jobs, size_t const& count, ThreadPool& pool );
+	};
+}
+
+#endif // !STATECODEC_CLASS_HPP
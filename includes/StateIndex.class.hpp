@@ -0,0 +1,102 @@
+#ifndef STATEINDEX_CLASS_HPP
+# define STATEINDEX_CLASS_HPP
+
+# include <inttypes.h> //Allow uint8_t on Debian
+# include <stddef.h>
+# include <string>
+
+# include "SaveState.class.hpp"
+# include "IScreen.class.hpp"
+
+/*
+
+***************************** STATE INDEX **********************************
+
+	What a state browser shows, without parsing a single state.
+
+	-- State files
+		The first chunk of a saved state is "META", a fixed layout Info,
+		so it always starts at STATE_INFO_OFFSET:
+
+			+------------------------------------+
+			| "GBMS"  format  0  size            |	file header
+			| "META"  1  0  size                 |	chunk header
+			| title  checksum  time  frames      |	Info, STATE_INFO_OFFSET
+			| thumbnail 40 x 36                  |
+			+------------------------------------+
+			| "CART" "ARNA"                      |	the state itself
+			+------------------------------------+
+
+		peek() reads the Info alone, one read of its size.
+
+	-- Index files
+		One per ROM, next to its states ( TITLE-checksum.gbmi ): an array
+		of Entry ( state path + Info ), added to or updated in place on
+		every save. A browser maps it read only and lists hundreds of
+		states from memory.
+
+	Values are raw, in host order, like the states.
+
+*/
+
+# define STATE_THUMB_WIDTH		(SCREEN_WIDTH / 4)
+# define STATE_THUMB_HEIGHT		(SCREEN_HEIGHT / 4)
+# define STATE_INFO_OFFSET		(2 * SAVESTATE_HEADER_SIZE)
+# define STATE_PATH_SIZE		256
+# define STATE_INDEX_EXT		".gbmi"
+
+namespace Gbmu
+{
+	class StateIndex
+	{
+		public:
+			struct Info
+			{
+				char		title[16];		// NUL terminated
+				uint16_t	checksum;		// cartridge global checksum
+				uint16_t	reserved[3];
+				int64_t		time;			// seconds since 1970
+				uint64_t	frames;			// frames run when it was saved
+				uint32_t	thumbnail[STATE_THUMB_WIDTH * STATE_THUMB_HEIGHT];	// 0xAARRGGBB
+			};
+
+			struct Entry
+			{
+				char		path[STATE_PATH_SIZE];	// NUL terminated
+				Info		info;
+			};
+
+		private:
+			Entry const*	_entries;		// mapped index, NULL when empty
+			size_t			_count;
+			size_t			_mapped;		// bytes
+
+			StateIndex ( StateIndex const & src );
+			StateIndex & operator=( StateIndex const & rhs );
+
+		public:
+			StateIndex ( void );
+			virtual ~StateIndex ( void );
+
+			// state files
+			static void			describe ( Info& info, std::string const& title, uint16_t const& checksum,
+									uint64_t const& frames, uint32_t const* pixels );
+			static void			write ( SaveState& state, Info const& info );	// first, on a cleared state
+			static bool			peek ( std::string const& statePath, Info& info );
+
+			// index files
+			static std::string	indexPath ( std::string const& statePath, Info const& info );
+			static bool			add ( std::string const& indexPath, std::string const& statePath, Info const& info );
+
+			bool				open ( std::string const& indexPath );	// map it, false if missing or damaged
+			void				close ( void );
+			size_t const&		count ( void ) const;
+			Entry const&		at ( size_t const& i ) const;
+	};
+}
+
+#else
+namespace Gbmu {
+	class StateIndex;
+}
+#endif // !STATEINDEX_CLASS_HPP
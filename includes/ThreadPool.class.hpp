@@ -0,0 +1,57 @@
+#ifndef THREADPOOL_CLASS_HPP
+# define THREADPOOL_CLASS_HPP
+
+# include <deque>
+# include <vector>
+# include <thread>
+# include <mutex>
+# include <condition_variable>
+# include <functional>
+
+/*
+
+***************************** THREAD POOL **********************************
+
+	A fixed set of workers taking tasks from one queue, for batches of
+	independent jobs ( compressing many states at once ):
+
+		run ( task ) --> [ queue ] --> worker 1 .. worker n
+		wait ()      <-- returns once the queue is empty and every
+		                 worker is idle
+
+	The workers are started once and sleep on a condition variable
+	between batches. Tasks are whole jobs ( milliseconds ), a lock per
+	task costs nothing next to them.
+
+*/
+
+namespace Gbmu
+{
+	class ThreadPool
+	{
+		private:
+			std::vector<std::thread>			_workers;
+			std::deque<std::function<void()> >	_tasks;
+			std::mutex							_lock;
+			std::condition_variable				_ready;		// a task was queued, or quit
+			std::condition_variable				_idle;		// a task was done
+			size_t								_busy;		// tasks running
+			bool								_quit;
+
+			ThreadPool ( ThreadPool const & src );
+			ThreadPool & operator=( ThreadPool const & rhs );
+
+		public:
+			ThreadPool ( size_t const& threads = 0 );		// 0: one per core
+			virtual ~ThreadPool ( void );					// after the tasks queued
+
+			void			run ( std::function<void()> const& task );
+			void			wait ( void );
+			size_t			size ( void ) const;
+
+		private:
+			void			_loop ( void );
+	};
+}
+
+#endif // !THREADPOOL_CLASS_HPP
@@ -0,0 +1,90 @@
+#ifndef TIMER_CLASS_HPP
+# define TIMER_CLASS_HPP
+
+# include <iostream>
+# include <inttypes.h> //Allow uint8_t on Debian
+
+# include "Cpu.class.hpp"
+
+/*
+
+******************************* TIMER ************************************
+
+	-- DIV Register (divider) [0xFF04]
+		upper 8 bits of a 16 bits counter incremented every clock cycle,
+		any write reset the whole counter to 0
+
+	-- TIMA Register (timer counter) [0xFF05]
+		incremented on the falling edge of one bit of the DIV counter,
+		on overflow it is reloaded with TMA and the timer interrupt is requested
+
+	-- TMA Register (timer modulo) [0xFF06]
+
+	-- TAC Register (timer control) [0xFF07]
+		BIT    2: 	timer enable
+		BITS 0-1: 	00 - 4096 Hz	( bit 9, every 1024 cycles )
+					01 - 262144 Hz	( bit 3, every 16 cycles )
+					10 - 65536 Hz	( bit 5, every 64 cycles )
+					11 - 16384 Hz	( bit 7, every 256 cycles )
+
+	Nothing is ticked: the DIV counter is ( now - divBase ), TIMA is
+	brought up to date only when it is read or a timer register is written,
+	and the next overflow is a Scheduler::TIMER event.
+	A write to DIV ( or TAC ) that makes the selected bit fall still
+	increments TIMA, like the hardware does.
+
+*/
+
+namespace Gbmu
+{
+	class Timer
+	{
+		private:
+			// in the arena
+			struct State
+			{
+				uint64_t	divBase;		// cycle the DIV counter was 0 at
+				uint64_t	lastSync;		// cycle TIMA is up to date at
+				uint16_t	tima;			// TIMA at lastSync
+				uint8_t		tma;
+				uint8_t		tac;
+			};
+
+			Cpu*			_cpu;
+			State*			_state;
+
+			Timer ( void );
+			Timer ( Timer const & src );
+			Timer & operator=( Timer const & rhs );
+
+		public:
+			Timer ( Cpu *cpu );
+			virtual ~Timer ( void );
+
+			void			reset ( void );
+
+			uint8_t			div ( void ) const;
+			uint8_t			tima ( void );
+			uint8_t			tma ( void ) const;
+			uint8_t			tac ( void ) const;
+
+			void			onWriteDIV ( void );
+			void			onWriteTIMA ( uint8_t const& value );
+			void			onWriteTMA ( uint8_t const& value );
+			void			onWriteTAC ( uint8_t const& value );
+
+		private:
+			static void		_onEvent ( void *owner, uint64_t const& when );
+			uint16_t		_counter ( uint64_t const& when ) const;
+			bool			_signal ( void ) const;
+			void			_increment ( uint64_t const& count );
+			void			_sync ( uint64_t const& when );
+			void			_schedule ( void );
+	};
+}
+
+#else
+namespace Gbmu {
+	class Timer;
+}
+#endif // !TIMER_CLASS_HPP
@@ -0,0 +1,40 @@
+#ifndef WAVSINK_CLASS_HPP
+# define WAVSINK_CLASS_HPP
+
+# include <string>
+# include <cstdio>
+
+# include "IAudioSink.class.hpp"
+
+/*
+** Write the samples in a 16 bits stereo PCM WAV file
+** The header sizes are patched on close
+*/
+
+namespace Gbmu
+{
+	class WavSink : public IAudioSink
+	{
+		private:
+			std::string		_path;
+			FILE*			_file;
+			uint32_t		_bytes;			// data chunk size
+
+			WavSink ( void );
+			WavSink ( WavSink const & src );
+			WavSink & operator=( WavSink const & rhs );
+
+			void			_writeHeader ( unsigned int const& rate );
+
+		public:
+			WavSink ( std::string const& path );
+			virtual ~WavSink ( void );
+
+			virtual bool	open ( unsigned int const& rate );
+			virtual void	write ( AudioSample const* samples, size_t const& count );
+			virtual void	close ( void );
+			virtual bool	realtime ( void ) const;
+	};
+}
+
+#endif // !WAVSINK_CLASS_HPP
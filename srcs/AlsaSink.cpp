@@ -0,0 +1,96 @@
+#include "../includes/AlsaSink.class.hpp"
+#ifdef GBMU_ALSA
+# include <alsa/asoundlib.h>
+#endif
+
+# define ALSA_LATENCY	50000		// device buffer in microseconds
+
+Gbmu::AlsaSink::AlsaSink (std::string const& device) :
+	_device(device),
+	_pcm(NULL)
+{}
+
+Gbmu::AlsaSink::~AlsaSink (void)
+{
+	this->close();
+}
+
+bool Gbmu::AlsaSink::realtime (void) const
+{
+	return (true);
+}
+
+#ifdef GBMU_ALSA
+
+bool Gbmu::AlsaSink::open (unsigned int const& rate)
+{
+	snd_pcm_t	*pcm;
+
+	this->close();
+	if (snd_pcm_open(&pcm, _device.c_str(), SND_PCM_STREAM_PLAYBACK, 0) < 0)
+		return (false);
+	if (snd_pcm_set_params(pcm, SND_PCM_FORMAT_S16, SND_PCM_ACCESS_RW_INTERLEAVED,
+				2, rate, 1, ALSA_LATENCY) < 0)
+	{
+		snd_pcm_close(pcm);
+		return (false);
+	}
+	_pcm = pcm;
+	return (true);
+}
+
+/*
+** Blocks until the device took every sample ( audio thread only )
+*/
+void Gbmu::AlsaSink::write (AudioSample const* samples, size_t const& count)
+{
+	snd_pcm_t			*pcm = static_cast<snd_pcm_t*>(_pcm);
+	snd_pcm_sframes_t	written;
+	size_t				done = 0;
+
+	while (pcm && done < count)
+	{
+		written = snd_pcm_writei(pcm, samples + done, count - done);
+		if (written < 0 && snd_pcm_recover(pcm, written, 1) < 0)
+			return ;
+		if (written > 0)
+			done += written;
+	}
+}
+
+void Gbmu::AlsaSink::close (void)
+{
+	if (_pcm == NULL)
+		return ;
+	snd_pcm_drain(static_cast<snd_pcm_t*>(_pcm));
+	snd_pcm_close(static_cast<snd_pcm_t*>(_pcm));
+	_pcm = NULL;
+}
+
+bool Gbmu::AlsaSink::available (void)
+{
+	return (true);
+}
+
+#else
+
+bool Gbmu::AlsaSink::open (unsigned int const& rate)
+{
+	(void)rate;
+	return (false);
+}
+
+void Gbmu::AlsaSink::write (AudioSample const* samples, size_t const& count)
+{
+	(void)samples;
+	(void)count;
+}
+
+void Gbmu::AlsaSink::close (void) {}
+
+bool Gbmu::AlsaSink::available (void)
+{
+	return (false);
+}
+
+#endif
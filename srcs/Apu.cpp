@@ -0,0 +1,702 @@
+#include "../includes/Apu.class.hpp"
+#include <algorithm>
+#include <new>
+
+/*
+** Bits read back as 1 for each register ( write only or unused bits )
+*/
+static const uint8_t	g_readMasks[APU_REG_SIZE] = {
+	0x80, 0x3F, 0x00, 0xFF, 0xBF,		// NR10 - NR14
+	0xFF, 0x3F, 0x00, 0xFF, 0xBF,		// ---- NR21 - NR24
+	0x7F, 0xFF, 0x9F, 0xFF, 0xBF,		// NR30 - NR34
+	0xFF, 0xFF, 0x00, 0x00, 0xBF,		// ---- NR41 - NR44
+	0x00, 0x00, 0x70,					// NR50 - NR52
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,		// wave RAM
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/*
+** Duty step outputs, bit N is the output of step N
+*/
+static const uint8_t	g_duties[4] = { 0x01, 0x81, 0x87, 0x7E };
+static const float		g_dutyAverages[4] = { 1 / 8.0f, 2 / 8.0f, 4 / 8.0f, 6 / 8.0f };
+
+static const uint8_t	g_noiseDivisors[8] = { 8, 16, 32, 48, 64, 80, 96, 112 };
+
+/*
+** Count down timer by cycles, reload it with period each time it expires
+** Return how many times it expired
+*/
+static inline uint32_t	stepTimer (uint32_t& timer, uint32_t const& period, uint32_t cycles)
+{
+	if (cycles < timer)
+	{
+		timer -= cycles;
+		return (0);
+	}
+	cycles -= timer;
+	timer = period - cycles % period;
+	return (1 + cycles / period);
+}
+
+/*
+** count LFSR steps at once, at most 14 ( 6 in 7 bits mode ): the new bits
+** only depend on bits still in the register
+** Return the outputs, bit N is bit 0 after step N + 1
+*/
+static inline uint16_t	stepLfsr (uint16_t& lfsr, uint32_t const& count, bool const& narrow)
+{
+	uint16_t	mask = (1 << count) - 1;
+	uint16_t	bits = (lfsr ^ (lfsr >> 1)) & mask;
+	uint16_t	out = (lfsr >> 1) & mask;
+	uint16_t	next = (lfsr >> count) | (bits << (15 - count));
+
+	if (narrow)
+		next = (next & ~0x7F) | ((lfsr & 0x7F) >> count) | (bits << (7 - count));
+	lfsr = next;
+	return (out);
+}
+
+Gbmu::Apu::Apu (Cpu *cpu, bool const& sound) :
+	_cpu(cpu),
+	_state(new (cpu->arena()->at<void>(ARENA_APU)) State),
+	_sound(sound),
+	_render(sound ? &Gbmu::Apu::_renderSamples : &Gbmu::Apu::_renderSilent),
+	_ratio((static_cast<uint64_t>(AUDIO_RATE) << 32) / CPU_CLOCK),
+	_baseRatio(_ratio),
+	_consumer(NONE),
+	_rateIntegral(0),
+	_muted(false),
+	_ring(sound ? new AudioRing : NULL),
+	_dropped(0),
+	_waiting(false)
+{
+	static_assert(sizeof(State) <= ARENA_REGISTERS - ARENA_APU, "the apu overlaps the registers");
+	this->reset();
+}
+
+Gbmu::Apu::~Apu (void)
+{
+	delete _ring;
+}
+
+/*
+** Powered on with the registers the boot rom leaves
+*/
+void Gbmu::Apu::reset (void)
+{
+	Scheduler*	scheduler = _cpu->scheduler();
+
+	std::memset(_state->regs, 0, sizeof(_state->regs));
+	std::memset(_state->square, 0, sizeof(_state->square));
+	std::memset(&_state->wave, 0, sizeof(_state->wave));
+	std::memset(&_state->noise, 0, sizeof(_state->noise));
+	_state->regs[NR52] = 0x80;
+	_state->regs[NR50] = 0x77;
+	_state->regs[NR51] = 0xF3;
+	_state->sequencerStep = 0;
+	_state->lastRun = scheduler->now();
+	_blockStart = _state->lastRun;
+	_blockFrac = 0;
+	for (int c = 0; c < MIXER_CHANNELS; c++)
+	{
+		_blep[c].clear();
+		_levels[c] = 0;
+	}
+	_mixer.setGains(_state->regs[NR50], _state->regs[NR51], _muted);
+	scheduler->setHandler(Scheduler::APU, &Gbmu::Apu::_onEvent, this);
+	scheduler->schedule(Scheduler::APU, _state->lastRun + FRAME_SEQUENCER_CYCLES);
+}
+
+/*
+** Registers and channels came with the arena, the output restarts from them
+*/
+void Gbmu::Apu::onRestore (void)
+{
+	_blockStart = _state->lastRun;
+	_blockFrac = 0;
+	for (int c = 0; c < MIXER_CHANNELS; c++)
+	{
+		_blep[c].clear();
+		_levels[c] = 0;
+	}
+	_mixer.setGains(_state->regs[NR50], _state->regs[NR51], _muted);
+}
+
+/*
+** Registers access [0xFF10 - 0xFF3F]
+*/
+uint8_t Gbmu::Apu::read (uint16_t const& addr) const
+{
+	uint8_t		offset = addr - IO_NR10;
+
+	if (offset == NR52)
+		return (g_readMasks[NR52] | (_state->regs[NR52] & 0x80) | (_state->square[0].on << 0)
+				| (_state->square[1].on << 1) | (_state->wave.on << 2) | (_state->noise.on << 3));
+	return (_state->regs[offset] | g_readMasks[offset]);
+}
+
+void Gbmu::Apu::write (uint16_t const& addr, uint8_t const& value)
+{
+	uint8_t		offset = addr - IO_NR10;
+
+	this->_run(_cpu->scheduler()->now());		// the past is rendered with the old values
+	if (offset >= WAVE)
+		_state->regs[offset] = value;
+	else if (offset == NR52)
+		this->_power(value & 0x80);
+	else if (_state->regs[NR52] & 0x80)				// registers are read only while powered off
+	{
+		_state->regs[offset] = value;
+		this->_writeChannel(offset, value);
+	}
+	this->_refresh();							// new levels start now
+}
+
+/*
+** Private
+*/
+
+void Gbmu::Apu::_writeChannel (uint8_t const& offset, uint8_t const& value)
+{
+	Square*		square = &_state->square[offset >= NR21];
+
+	switch (offset)
+	{
+		case NR11:
+		case NR21:
+			square->duty = value >> 6;
+			square->length = 64 - (value & 0x3F);
+			break;
+		case NR12:
+		case NR22:
+			square->on = square->on && this->_dac(offset >= NR21);
+			break;
+		case NR13:
+		case NR23:
+			square->freq = (square->freq & 0x700) | value;
+			break;
+		case NR14:
+		case NR24:
+			square->freq = (square->freq & 0xFF) | ((value & 0x07) << 8);
+			if (value & 0x80)
+				this->_trigger(offset >= NR21);
+			break;
+		case NR30:
+			_state->wave.on = _state->wave.on && this->_dac(2);
+			break;
+		case NR31:
+			_state->wave.length = 256 - value;
+			break;
+		case NR33:
+			_state->wave.freq = (_state->wave.freq & 0x700) | value;
+			break;
+		case NR34:
+			_state->wave.freq = (_state->wave.freq & 0xFF) | ((value & 0x07) << 8);
+			if (value & 0x80)
+				this->_trigger(2);
+			break;
+		case NR41:
+			_state->noise.length = 64 - (value & 0x3F);
+			break;
+		case NR42:
+			_state->noise.on = _state->noise.on && this->_dac(3);
+			break;
+		case NR44:
+			if (value & 0x80)
+				this->_trigger(3);
+			break;
+		case NR50:
+		case NR51:
+			_mixer.setGains(_state->regs[NR50], _state->regs[NR51], _muted);
+			break;
+	}
+}
+
+/*
+** Render everything up to now ( end of a frame, before reading the samples .. )
+*/
+void Gbmu::Apu::sync (void)
+{
+	this->_run(_cpu->scheduler()->now());
+}
+
+bool const& Gbmu::Apu::sound (void) const
+{
+	return (_sound);
+}
+
+/*
+** Muted samples are still produced so the stream keeps its timing
+*/
+void Gbmu::Apu::setMuted (bool const& b)
+{
+	_muted = b;
+	_mixer.setGains(_state->regs[NR50], _state->regs[NR51], _muted);
+}
+
+bool const& Gbmu::Apu::muted (void) const
+{
+	return (_muted);
+}
+
+/*
+** Who reads the ring decides what a full ring does, see APU
+*/
+void Gbmu::Apu::setConsumer (Consumer const& consumer)
+{
+	_consumer.store(consumer);
+	_ratio = _baseRatio;
+	_rateIntegral = 0;
+	std::lock_guard<std::mutex>		guard(_lock);
+
+	_room.notify_all();			// a STREAM producer may sleep on a full ring
+}
+
+double Gbmu::Apu::rate (void) const
+{
+	return (static_cast<double>(_ratio) * CPU_CLOCK / (static_cast<uint64_t>(1) << 32));
+}
+
+/*
+** Pop up to max samples, return how many were read
+*/
+size_t Gbmu::Apu::readSamples (AudioSample *out, size_t const& max)
+{
+	size_t	count = 0;
+
+	while (_ring && count < max && _ring->pop(out[count]))
+		count++;
+	if (count == 0)
+		return (0);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_waiting.load(std::memory_order_relaxed))
+	{
+		std::lock_guard<std::mutex>		guard(_lock);
+
+		_room.notify_one();
+	}
+	return (count);
+}
+
+Gbmu::AudioRing& Gbmu::Apu::ring (void) const { return (*_ring); }
+uint64_t const& Gbmu::Apu::dropped (void) const { return (_dropped); }
+
+/*
+** Scheduler event: frame sequencer step
+*/
+void Gbmu::Apu::_onEvent (void *owner, uint64_t const& when)
+{
+	Apu*	apu = static_cast<Apu*>(owner);
+
+	apu->_run(when);
+	if (apu->_state->regs[NR52] & 0x80)
+	{
+		apu->_clockSequencer();
+		apu->_refresh();
+	}
+	apu->_cpu->scheduler()->schedule(Scheduler::APU, when + FRAME_SEQUENCER_CYCLES);
+}
+
+/*
+** Render up to until, in chunks the bleps can hold
+*/
+void Gbmu::Apu::_run (uint64_t const& until)
+{
+	while (until > _state->lastRun + FRAME_SEQUENCER_CYCLES)
+		(this->*_render)(_state->lastRun + FRAME_SEQUENCER_CYCLES);
+	if (until > _state->lastRun)
+		(this->*_render)(until);
+}
+
+void Gbmu::Apu::_renderSamples (uint64_t const& until)
+{
+	this->_runSquare(0, until);
+	this->_runSquare(1, until);
+	this->_runWave(until);
+	this->_runNoise(until);
+	_state->lastRun = until;
+	this->_flush();
+}
+
+/*
+** Without sound the channel outputs are never needed, only the time moves
+*/
+void Gbmu::Apu::_renderSilent (uint64_t const& until)
+{
+	_state->lastRun = until;
+}
+
+/*
+** Walk the channel timer up to until, each step that changes the output
+** goes to the blep at its exact cycle
+*/
+void Gbmu::Apu::_runSquare (int const& i, uint64_t const& until)
+{
+	Square&		square = _state->square[i];
+	uint32_t	period = (2048 - square.freq) * 4;
+	uint64_t	t = _state->lastRun;
+
+	if (square.on == false)
+		return ;
+	if (period * 8 < APU_ULTRASONIC_CYCLES)		// constant average, only keep the position
+	{
+		square.pos = (square.pos + stepTimer(square.timer, period, until - t)) & 0x07;
+		return ;
+	}
+	while (t + square.timer <= until)
+	{
+		t += square.timer;
+		square.timer = period;
+		square.pos = (square.pos + 1) & 0x07;
+		this->_setLevel(i, t);
+	}
+	square.timer -= until - t;
+}
+
+void Gbmu::Apu::_runWave (uint64_t const& until)
+{
+	uint32_t	period = (2048 - _state->wave.freq) * 2;
+	uint64_t	t = _state->lastRun;
+
+	if (_state->wave.on == false)
+		return ;
+	if (period * 32 < APU_ULTRASONIC_CYCLES)
+	{
+		_state->wave.pos = (_state->wave.pos + stepTimer(_state->wave.timer, period, until - t)) & 0x1F;
+		return ;
+	}
+	while (t + _state->wave.timer <= until)
+	{
+		t += _state->wave.timer;
+		_state->wave.timer = period;
+		_state->wave.pos = (_state->wave.pos + 1) & 0x1F;
+		this->_setLevel(2, t);
+	}
+	_state->wave.timer -= until - t;
+}
+
+/*
+** The LFSR runs by chunks of steps, only the steps that flip the output
+** ( and the first of each chunk ) go to the blep: the same steps as one
+** step at a time
+*/
+void Gbmu::Apu::_runNoise (uint64_t const& until)
+{
+	Noise&		noise = _state->noise;
+	uint8_t		shift = _state->regs[NR43] >> 4;
+	uint32_t	period = g_noiseDivisors[_state->regs[NR43] & 0x07] << shift;
+	bool		narrow = _state->regs[NR43] & 0x08;			// 7 bits mode
+	uint64_t	t = _state->lastRun;
+	uint64_t	steps;
+	uint32_t	count, step;
+	uint16_t	out, flips;
+	float		high = noise.volume * 2 - 15;
+
+	if (noise.on == false || shift >= 14)
+		return ;
+	if (t + noise.timer > until)
+	{
+		noise.timer -= until - t;
+		return ;
+	}
+	steps = 1 + (until - t - noise.timer) / period;
+	t = t + noise.timer - period;				// before the first step
+	while (steps > 0)
+	{
+		count = steps < (narrow ? 6 : 14) ? steps : (narrow ? 6 : 14);
+		flips = noise.lfsr & 0x01;
+		out = stepLfsr(noise.lfsr, count, narrow);
+		flips = ((out ^ ((out << 1) | flips)) & ((1 << count) - 1)) | 0x01;
+		while (flips)
+		{
+			step = __builtin_ctz(flips);
+			flips &= flips - 1;
+			this->_setLevel(3, t + (step + 1) * static_cast<uint64_t>(period), ((out >> step) & 0x01) ? -15 : high);
+		}
+		t += count * static_cast<uint64_t>(period);
+		steps -= count;
+	}
+	noise.timer = period - (until - t);
+}
+
+/*
+** Current output of a channel, -15 .. 15 ( 0 when off )
+*/
+float Gbmu::Apu::_level (int const& channel) const
+{
+	Square const&	square = _state->square[channel & 0x01];
+	uint8_t			shift = (_state->regs[NR32] >> 5) & 0x03;
+	float			wave = 0;
+
+	switch (channel)
+	{
+		case 0:
+		case 1:
+			if (square.on == false)
+				return (0);
+			if ((2048 - square.freq) * 32 < APU_ULTRASONIC_CYCLES)
+				return (g_dutyAverages[square.duty] * square.volume * 2 - 15);
+			return (((g_duties[square.duty] >> square.pos) & 0x01) * square.volume * 2 - 15);
+		case 2:
+			if (_state->wave.on == false)
+				return (0);
+			if (shift == 0)
+				return (-15);
+			if ((2048 - _state->wave.freq) * 64 < APU_ULTRASONIC_CYCLES)
+			{
+				for (int i = 0; i < 16; i++)
+					wave += (_state->regs[WAVE + i] >> 4) + (_state->regs[WAVE + i] & 0x0F);
+				return ((wave / 32) / (1 << (shift - 1)) * 2 - 15);
+			}
+			wave = (_state->wave.pos & 0x01) ? _state->regs[WAVE + _state->wave.pos / 2] & 0x0F : _state->regs[WAVE + _state->wave.pos / 2] >> 4;
+			return ((static_cast<int>(wave) >> (shift - 1)) * 2 - 15);
+		default:
+			if (_state->noise.on == false)
+				return (0);
+			return ((~_state->noise.lfsr & 0x01) * _state->noise.volume * 2 - 15);
+	}
+}
+
+void Gbmu::Apu::_setLevel (int const& channel, uint64_t const& when)
+{
+	this->_setLevel(channel, when, this->_level(channel));
+}
+
+void Gbmu::Apu::_setLevel (int const& channel, uint64_t const& when, float const& level)
+{
+	if (level != _levels[channel])
+	{
+		_blep[channel].addDelta(this->_position(when), level - _levels[channel]);
+		_levels[channel] = level;
+	}
+}
+
+/*
+** After a register write or a sequencer step ( volume, length, trigger .. )
+*/
+void Gbmu::Apu::_refresh (void)
+{
+	if (_sound == false)
+		return ;
+	for (int c = 0; c < MIXER_CHANNELS; c++)
+		this->_setLevel(c, _state->lastRun);
+}
+
+/*
+** Mix every whole sample before _state->lastRun and push them at once
+*/
+void Gbmu::Apu::_flush (void)
+{
+	uint64_t		pos = this->_position(_state->lastRun);
+	size_t			count = pos >> 32;
+	float const*	channels[MIXER_CHANNELS];
+	size_t			pushed;
+
+	if (count == 0)
+		return ;
+	for (int c = 0; c < MIXER_CHANNELS; c++)
+	{
+		_blep[c].read(_samples[c], count);
+		channels[c] = _samples[c];
+	}
+	_mixer.mix(channels, _block, count);
+	pushed = _ring->push(_block, count);
+	while (pushed < count && _consumer.load() == STREAM)
+	{
+		this->_waitRoom();
+		pushed += _ring->push(_block + pushed, count - pushed);
+	}
+	_dropped += count - pushed;
+	if (_consumer == REALTIME)
+		this->_adjustRate();
+	_blockStart = _state->lastRun;
+	_blockFrac = pos - (static_cast<uint64_t>(count) << 32);
+}
+
+/*
+** Sleep while the ring is full and a STREAM consumer is there to empty it
+*/
+void Gbmu::Apu::_waitRoom (void)
+{
+	std::unique_lock<std::mutex>	guard(_lock);
+
+	_waiting.store(true, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	while (_ring->size() == _ring->capacity() && _consumer.load() == STREAM)
+		_room.wait(guard);
+	_waiting.store(false, std::memory_order_relaxed);
+}
+
+/*
+** Proportional control on the ring fill, see Rate control
+*/
+void Gbmu::Apu::_adjustRate (void)
+{
+	double		half = AUDIO_RING_SIZE / 2;
+	double		error = (half - _ring->size()) / half;
+	double		adjust;
+
+	adjust = error + _rateIntegral;
+	if (adjust > -1 && adjust < 1)				// no windup while the adjustment is at its limit
+		_rateIntegral += error * AUDIO_RATE_INTEGRAL;
+	adjust = std::max(-1.0, std::min(1.0, adjust)) / AUDIO_MAX_ADJUST;
+	_ratio = _baseRatio + static_cast<int64_t>(_baseRatio * adjust);
+}
+
+/*
+** Position of a cycle in the current block, in output samples ( 32.32 )
+*/
+uint64_t Gbmu::Apu::_position (uint64_t const& when) const
+{
+	return ((when - _blockStart) * _ratio + _blockFrac);
+}
+
+void Gbmu::Apu::_clockSequencer (void)
+{
+	if ((_state->sequencerStep & 0x01) == 0)
+		this->_clockLength();
+	if (_state->sequencerStep == 2 || _state->sequencerStep == 6)
+		this->_clockSweep();
+	if (_state->sequencerStep == 7)
+		this->_clockEnvelope();
+	_state->sequencerStep = (_state->sequencerStep + 1) & 0x07;
+}
+
+void Gbmu::Apu::_clockLength (void)
+{
+	if ((_state->regs[NR14] & 0x40) && _state->square[0].length && --_state->square[0].length == 0)
+		_state->square[0].on = false;
+	if ((_state->regs[NR24] & 0x40) && _state->square[1].length && --_state->square[1].length == 0)
+		_state->square[1].on = false;
+	if ((_state->regs[NR34] & 0x40) && _state->wave.length && --_state->wave.length == 0)
+		_state->wave.on = false;
+	if ((_state->regs[NR44] & 0x40) && _state->noise.length && --_state->noise.length == 0)
+		_state->noise.on = false;
+}
+
+void Gbmu::Apu::_clockEnvelope (void)
+{
+	uint8_t		envelopes[3] = { _state->regs[NR12], _state->regs[NR22], _state->regs[NR42] };
+	uint8_t*	volumes[3] = { &_state->square[0].volume, &_state->square[1].volume, &_state->noise.volume };
+	uint8_t*	timers[3] = { &_state->square[0].envTimer, &_state->square[1].envTimer, &_state->noise.envTimer };
+
+	for (int i = 0; i < 3; i++)
+	{
+		if ((envelopes[i] & 0x07) == 0 || *timers[i] == 0 || --*timers[i] != 0)
+			continue ;
+		*timers[i] = envelopes[i] & 0x07;
+		if ((envelopes[i] & 0x08) && *volumes[i] < 15)
+			(*volumes[i])++;
+		else if ((envelopes[i] & 0x08) == 0 && *volumes[i] > 0)
+			(*volumes[i])--;
+	}
+}
+
+void Gbmu::Apu::_clockSweep (void)
+{
+	Square&		square = _state->square[0];
+	uint8_t		period = (_state->regs[NR10] >> 4) & 0x07;
+	uint16_t	freq;
+
+	if (square.sweepTimer == 0 || --square.sweepTimer != 0)
+		return ;
+	square.sweepTimer = period ? period : 8;
+	if (square.sweepOn == false || period == 0)
+		return ;
+	freq = this->_sweepFrequency();
+	if (freq <= 2047 && (_state->regs[NR10] & 0x07))
+	{
+		square.shadow = freq;
+		square.freq = freq;
+		_state->regs[NR13] = freq & 0xFF;
+		_state->regs[NR14] = (_state->regs[NR14] & ~0x07) | (freq >> 8);
+		this->_sweepFrequency();				// overflow check with the new frequency
+	}
+}
+
+/*
+** Next sweep frequency, channel 1 is disabled when it overflows
+*/
+uint16_t Gbmu::Apu::_sweepFrequency (void)
+{
+	Square&		square = _state->square[0];
+	uint16_t	delta = square.shadow >> (_state->regs[NR10] & 0x07);
+	uint16_t	freq = (_state->regs[NR10] & 0x08) ? square.shadow - delta : square.shadow + delta;
+
+	if (freq > 2047)
+		square.on = false;
+	return (freq);
+}
+
+void Gbmu::Apu::_trigger (int const& channel)
+{
+	uint8_t		envelope = (channel == 3) ? _state->regs[NR42] : _state->regs[channel ? NR22 : NR12];
+	Square&		square = _state->square[channel & 0x01];
+
+	switch (channel)
+	{
+		case 0:
+		case 1:
+			square.on = this->_dac(channel);
+			square.length = square.length ? square.length : 64;
+			square.timer = (2048 - square.freq) * 4;
+			square.volume = envelope >> 4;
+			square.envTimer = envelope & 0x07;
+			if (channel == 0)
+			{
+				square.shadow = square.freq;
+				square.sweepTimer = ((_state->regs[NR10] >> 4) & 0x07) ? (_state->regs[NR10] >> 4) & 0x07 : 8;
+				square.sweepOn = (_state->regs[NR10] & 0x77) != 0;
+				if (_state->regs[NR10] & 0x07)
+					this->_sweepFrequency();
+			}
+			break;
+		case 2:
+			_state->wave.on = this->_dac(2);
+			_state->wave.length = _state->wave.length ? _state->wave.length : 256;
+			_state->wave.timer = (2048 - _state->wave.freq) * 2;
+			_state->wave.pos = 0;
+			break;
+		case 3:
+			_state->noise.on = this->_dac(3);
+			_state->noise.length = _state->noise.length ? _state->noise.length : 64;
+			_state->noise.timer = g_noiseDivisors[_state->regs[NR43] & 0x07] << (_state->regs[NR43] >> 4);
+			_state->noise.lfsr = 0x7FFF;
+			_state->noise.volume = envelope >> 4;
+			_state->noise.envTimer = envelope & 0x07;
+			break;
+	}
+}
+
+/*
+** NR52 bit 7, powering off clears every register but the wave RAM
+*/
+void Gbmu::Apu::_power (bool const& on)
+{
+	if (on && (_state->regs[NR52] & 0x80) == 0)
+		_state->sequencerStep = 0;
+	if (on == false)
+	{
+		std::memset(_state->regs, 0, NR52);
+		std::memset(_state->square, 0, sizeof(_state->square));
+		std::memset(&_state->wave, 0, sizeof(_state->wave));
+		std::memset(&_state->noise, 0, sizeof(_state->noise));
+	}
+	_state->regs[NR52] = on ? 0x80 : 0x00;
+}
+
+/*
+** A channel DAC is off when its volume / direction bits are all 0 ( NR30 bit 7 for the wave )
+*/
+bool Gbmu::Apu::_dac (int const& channel) const
+{
+	switch (channel)
+	{
+		case 0: return ((_state->regs[NR12] & 0xF8) != 0);
+		case 1: return ((_state->regs[NR22] & 0xF8) != 0);
+		case 2: return ((_state->regs[NR30] & 0x80) != 0);
+		default: return ((_state->regs[NR42] & 0xF8) != 0);
+	}
+}
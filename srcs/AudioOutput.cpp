@@ -0,0 +1,85 @@
+#include "../includes/AudioOutput.class.hpp"
+#include <chrono>
+
+Gbmu::AudioOutput::AudioOutput (Apu *apu) :
+	_apu(apu),
+	_sink(NULL),
+	_thread(NULL),
+	_stop(false)
+{}
+
+Gbmu::AudioOutput::~AudioOutput (void)
+{
+	this->stop();
+}
+
+/*
+** Open the sink and start feeding it, samples already queued are dropped
+*/
+bool Gbmu::AudioOutput::start (IAudioSink *sink)
+{
+	this->stop();
+	if (sink == NULL || _apu->sound() == false || sink->open(AUDIO_RATE) == false)
+		return (false);
+	while (this->_drain())
+		;
+	_sink = sink;
+	_stop.store(false);
+	_apu->setConsumer(sink->realtime() ? Apu::REALTIME : Apu::STREAM);
+	_thread = new std::thread(&Gbmu::AudioOutput::_loop, this);
+	return (true);
+}
+
+/*
+** Hand every queued sample to the sink, then close it
+*/
+void Gbmu::AudioOutput::stop (void)
+{
+	size_t	count;
+
+	if (_thread == NULL)
+		return ;
+	_apu->setConsumer(Apu::NONE);
+	_stop.store(true);
+	_thread->join();
+	delete _thread;
+	_thread = NULL;
+	while ((count = this->_drain()))
+		_sink->write(_buffer, count);
+	_sink->close();
+	_sink = NULL;
+}
+
+Gbmu::IAudioSink* Gbmu::AudioOutput::sink (void) const
+{
+	return (_sink);
+}
+
+/*
+** Private
+*/
+
+/*
+** A realtime sink starts once the ring is half full, the rate control
+** then keeps it there
+*/
+void Gbmu::AudioOutput::_loop (void)
+{
+	size_t	count;
+
+	while (_sink->realtime() && _stop.load() == false
+			&& _apu->ring().size() < AUDIO_RING_SIZE / 2)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	while (_stop.load() == false)
+	{
+		if ((count = this->_drain()))
+			_sink->write(_buffer, count);
+		else
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+size_t Gbmu::AudioOutput::_drain (void)
+{
+	return (_apu->readSamples(_buffer, AUDIO_BLOCK));
+}
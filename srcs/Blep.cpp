@@ -0,0 +1,71 @@
+#include "../includes/Blep.class.hpp"
+#include <cmath>
+
+/*
+** Kernels of every phase, built once at startup
+*/
+struct BlepKernel
+{
+	float	taps[BLEP_PHASES][BLEP_TAPS];
+
+	BlepKernel (void)
+	{
+		double	t, x, sinc, window, sum;
+		double	weights[BLEP_TAPS];
+
+		for (int phase = 0; phase < BLEP_PHASES; phase++)
+		{
+			sum = 0;
+			for (int k = 0; k < BLEP_TAPS; k++)
+			{
+				t = k - BLEP_TAPS / 2 - static_cast<double>(phase) / BLEP_PHASES;
+				x = M_PI * 0.9 * t;
+				sinc = (x == 0) ? 1.0 : std::sin(x) / x;
+				window = 0.42 + 0.5 * std::cos(2 * M_PI * t / BLEP_TAPS)
+					+ 0.08 * std::cos(4 * M_PI * t / BLEP_TAPS);
+				weights[k] = sinc * window;
+				sum += weights[k];
+			}
+			for (int k = 0; k < BLEP_TAPS; k++)		// a step keeps its exact height
+				taps[phase][k] = weights[k] / sum;
+		}
+	}
+};
+
+static const BlepKernel		g_kernel;
+
+Gbmu::Blep::Blep (void)
+{
+	this->clear();
+}
+
+Gbmu::Blep::~Blep (void) {}
+
+void Gbmu::Blep::clear (void)
+{
+	std::memset(_buffer, 0, sizeof(_buffer));
+	_sum = 0;
+}
+
+void Gbmu::Blep::addDelta (uint64_t const& pos, float const& delta)
+{
+	float const*	taps = g_kernel.taps[(pos >> (32 - 5)) & (BLEP_PHASES - 1)];
+	float*			out = _buffer + (pos >> 32);
+
+	for (int k = 0; k < BLEP_TAPS; k++)
+		out[k] += taps[k] * delta;
+}
+
+/*
+** Integrate count samples, keep the kernel tails for the next read
+*/
+void Gbmu::Blep::read (float *out, size_t const& count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		_sum = _sum * BLEP_LEAK + _buffer[i];
+		out[i] = _sum;
+	}
+	std::memmove(_buffer, _buffer + count, BLEP_TAPS * sizeof(float));
+	std::memset(_buffer + BLEP_TAPS, 0, count * sizeof(float));
+}
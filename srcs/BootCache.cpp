@@ -0,0 +1,137 @@
+#include "../includes/BootCache.class.hpp"
+#include "../includes/Gb.class.hpp"
+#include <cstdio>
+#include <cstring>
+#include <cctype>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+Gbmu::BootCache::BootCache (void) :
+	_map(NULL),
+	_mapped(0)
+{}
+
+Gbmu::BootCache::~BootCache (void)
+{
+	this->close();
+}
+
+/*
+** TITLE-checksum-model-point, each point of a ROM has its own file
+*/
+std::string Gbmu::BootCache::path (std::string const& dir, std::string const& title, Key const& key)
+{
+	static char const*	models[] = { "auto", "dmg", "cgb" };
+	std::string			name;
+	char				suffix[64];
+
+	for (size_t i = 0; i < title.size(); i++)
+		name += std::isalnum(static_cast<unsigned char>(title[i])) ? title[i] : '_';
+	if (key.trigger == PC)
+		std::snprintf(suffix, sizeof(suffix), "-%04x-%s-pc%04llx", key.checksum,
+			key.model <= 2 ? models[key.model] : "?", static_cast<unsigned long long>(key.at));
+	else
+		std::snprintf(suffix, sizeof(suffix), "-%04x-%s-f%llu", key.checksum,
+			key.model <= 2 ? models[key.model] : "?", static_cast<unsigned long long>(key.at));
+	return ((dir.empty() ? "" : dir + "/") + name + suffix + BOOTCACHE_EXT);
+}
+
+/*
+** Written aside then renamed, a reader maps the old file or the new one
+*/
+bool Gbmu::BootCache::write (std::string const& path, Key const& key, uint64_t const& frames,
+	SaveState const& state)
+{
+	Header			header;
+	std::string		temp;
+	char			pid[16];
+	FILE*			file;
+	bool			ok;
+
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, BOOTCACHE_MAGIC, 4);
+	header.format = BOOTCACHE_FORMAT;
+	header.checksum = key.checksum;
+	std::strncpy(header.version, GB_VERSION, sizeof(header.version) - 1);
+	header.model = key.model;
+	header.trigger = key.trigger;
+	header.type = key.type;
+	header.romSize = key.romSize;
+	header.size = state.size();
+	header.at = key.at;
+	header.frames = frames;
+	std::snprintf(pid, sizeof(pid), ".%d", static_cast<int>(getpid()));
+	temp = path + pid;
+	if ((file = fopen(temp.c_str(), "wb")) == NULL)
+		return (false);
+	ok = fwrite(&header, sizeof(header), 1, file) == 1
+		&& fwrite(state.data(), 1, state.size(), file) == state.size();
+	ok = fclose(file) == 0 && ok && std::rename(temp.c_str(), path.c_str()) == 0;
+	if (ok == false)
+		std::remove(temp.c_str());
+	return (ok);
+}
+
+bool Gbmu::BootCache::open (std::string const& path, Key const& key)
+{
+	struct stat		st;
+	Header			header;
+	void*			map;
+	int				fd;
+
+	this->close();
+	if ((fd = ::open(path.c_str(), O_RDONLY)) < 0)
+		return (false);
+	if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Header))
+		|| (map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+	{
+		::close(fd);
+		return (false);
+	}
+	::close(fd);
+	_map = static_cast<uint8_t const*>(map);
+	_mapped = st.st_size;
+	std::memcpy(&header, _map, sizeof(header));
+	if (std::memcmp(header.magic, BOOTCACHE_MAGIC, 4) != 0
+		|| header.format != BOOTCACHE_FORMAT
+		|| std::strncmp(header.version, GB_VERSION, sizeof(header.version)) != 0
+		|| header.checksum != key.checksum || header.model != key.model
+		|| header.trigger != key.trigger || header.at != key.at
+		|| header.type != key.type || header.romSize != key.romSize
+		|| header.size != _mapped - sizeof(header))
+	{
+		this->close();
+		return (false);
+	}
+	return (true);
+}
+
+void Gbmu::BootCache::close (void)
+{
+	if (_map)
+		munmap(const_cast<uint8_t*>(_map), _mapped);
+	_map = NULL;
+	_mapped = 0;
+}
+
+uint8_t const* Gbmu::BootCache::state (void) const
+{
+	return (_map ? _map + sizeof(Header) : NULL);
+}
+
+size_t Gbmu::BootCache::size (void) const
+{
+	return (_map ? _mapped - sizeof(Header) : 0);
+}
+
+uint64_t Gbmu::BootCache::frames (void) const
+{
+	Header		header;
+
+	if (_map == NULL)
+		return (0);
+	std::memcpy(&header, _map, sizeof(header));
+	return (header.frames);
+}
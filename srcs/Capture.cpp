@@ -0,0 +1,287 @@
+#include "../includes/Capture.class.hpp"
+#include <cstring>
+#include <sstream>
+#include <iomanip>
+#include <unistd.h>
+
+Gbmu::Capture::Capture (size_t const& depth) :
+	_slots(depth),
+	_head(0),
+	_count(0),
+	_thread(NULL),
+	_stop(false),
+	_pngPrefix("frame"),
+	_stream(NULL),
+	_format(NONE),
+	_buffer(new uint8_t[SCREEN_WIDTH * SCREEN_HEIGHT * 3])
+{
+	for (size_t i = 0; i < _slots.size(); i++)
+		_slots[i].pixels = new uint32_t[SCREEN_WIDTH * SCREEN_HEIGHT];
+}
+
+Gbmu::Capture::~Capture (void)
+{
+	this->stop();
+	for (size_t i = 0; i < _slots.size(); i++)
+		delete[] _slots[i].pixels;
+	delete[] _buffer;
+	if (_stream)
+		fclose(_stream);
+}
+
+void Gbmu::Capture::addPngFrame (uint64_t const& frame)
+{
+	_pngFrames.insert(frame);
+}
+
+void Gbmu::Capture::setPngPrefix (std::string const& prefix)
+{
+	_pngPrefix = prefix;
+}
+
+/*
+** Open the RAW / Y4M output, "-" is the standard output
+** When stdout is used, everything else printed on stdout goes to stderr
+*/
+bool Gbmu::Capture::openStream (std::string const& path, Format const& format)
+{
+	int		fd;
+
+	if (path == "-")
+	{
+		fflush(stdout);
+		if ((fd = dup(STDOUT_FILENO)) < 0 || dup2(STDERR_FILENO, STDOUT_FILENO) < 0)
+			return (false);
+		_stream = fdopen(fd, "wb");
+	}
+	else
+		_stream = fopen(path.c_str(), "wb");
+	if (_stream == NULL)
+		return (false);
+	_format = format;
+	if (_format == Y4M)
+		fprintf(_stream, "YUV4MPEG2 W%d H%d F4194304:70224 Ip A1:1 C444\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+	return (true);
+}
+
+void Gbmu::Capture::start (void)
+{
+	if (_thread)
+		return ;
+	_stop = false;
+	_thread = new std::thread(&Gbmu::Capture::_writerLoop, this);
+}
+
+/*
+** Write every queued frame then join the writer thread
+*/
+void Gbmu::Capture::stop (void)
+{
+	if (_thread == NULL)
+		return ;
+	{
+		std::lock_guard<std::mutex>	lock(_mutex);
+
+		_stop = true;
+	}
+	_notEmpty.notify_one();
+	_thread->join();
+	delete _thread;
+	_thread = NULL;
+	if (_stream)
+		fflush(_stream);
+}
+
+/*
+** Called by the ppu, copy the frame in a free slot if anybody wants it
+*/
+void Gbmu::Capture::onFrame (uint32_t const* pixels, uint64_t const& frame)
+{
+	bool	png = _pngFrames.count(frame) != 0;
+	Slot*	slot;
+
+	if (png == false && _stream == NULL)
+		return ;
+	{
+		std::unique_lock<std::mutex>	lock(_mutex);
+
+		while (_count == _slots.size())
+			_notFull.wait(lock);
+		slot = &_slots[(_head + _count) % _slots.size()];
+	}
+	slot->frame = frame;
+	slot->png = png;
+	std::memcpy(slot->pixels, pixels, SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint32_t));
+	{
+		std::lock_guard<std::mutex>	lock(_mutex);
+
+		_count++;
+	}
+	_notEmpty.notify_one();
+}
+
+/*
+** Minimal PNG encoder: RGB 8 bits, zlib stream made of stored blocks
+** No compression, but no dependency and nearly free to produce
+*/
+
+static uint32_t	crc32(uint32_t crc, uint8_t const* data, size_t size)
+{
+	static uint32_t		table[256];
+	uint32_t			c;
+
+	if (table[1] == 0)
+	{
+		for (uint32_t n = 0; n < 256; n++)
+		{
+			c = n;
+			for (int k = 0; k < 8; k++)
+				c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+			table[n] = c;
+		}
+	}
+	crc = ~crc;
+	for (size_t i = 0; i < size; i++)
+		crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	return (~crc);
+}
+
+static void		putBe32(std::string& out, uint32_t value)
+{
+	out += static_cast<char>(value >> 24);
+	out += static_cast<char>(value >> 16);
+	out += static_cast<char>(value >> 8);
+	out += static_cast<char>(value);
+}
+
+static void		putChunk(std::string& out, char const* type, std::string const& data)
+{
+	std::string		chunk(type, 4);
+
+	chunk += data;
+	putBe32(out, data.size());
+	out += chunk;
+	putBe32(out, crc32(0, reinterpret_cast<uint8_t const*>(chunk.data()), chunk.size()));
+}
+
+bool Gbmu::Capture::writePng (std::string const& path, uint32_t const* pixels)
+{
+	std::ofstream	file(path.c_str(), std::ios::binary);
+	std::string		png("\x89PNG\r\n\x1a\n", 8);
+	std::string		header;
+	std::string		raw;
+	std::string		zlib("\x78\x01", 2);
+	uint32_t		a = 1, b = 0;
+	size_t			size;
+
+	if (!file)
+		return (false);
+	putBe32(header, SCREEN_WIDTH);
+	putBe32(header, SCREEN_HEIGHT);
+	header += std::string("\x08\x02\x00\x00\x00", 5);	// 8 bits, RGB, deflate, no filter, no interlace
+	for (int y = 0; y < SCREEN_HEIGHT; y++)
+	{
+		raw += '\0';									// filter type none
+		for (int x = 0; x < SCREEN_WIDTH; x++)
+		{
+			raw += static_cast<char>(pixels[y * SCREEN_WIDTH + x] >> 16);
+			raw += static_cast<char>(pixels[y * SCREEN_WIDTH + x] >> 8);
+			raw += static_cast<char>(pixels[y * SCREEN_WIDTH + x]);
+		}
+	}
+	for (size_t i = 0; i < raw.size(); i += size)		// stored blocks of max 0xFFFF bytes
+	{
+		size = std::min(raw.size() - i, static_cast<size_t>(0xFFFF));
+		zlib += static_cast<char>(i + size == raw.size());
+		zlib += static_cast<char>(size);
+		zlib += static_cast<char>(size >> 8);
+		zlib += static_cast<char>(~size);
+		zlib += static_cast<char>(~size >> 8);
+		zlib.append(raw, i, size);
+	}
+	for (size_t i = 0; i < raw.size(); i++)				// adler32
+	{
+		a = (a + static_cast<uint8_t>(raw[i])) % 65521;
+		b = (b + a) % 65521;
+	}
+	putBe32(zlib, (b << 16) | a);
+	putChunk(png, "IHDR", header);
+	putChunk(png, "IDAT", zlib);
+	putChunk(png, "IEND", "");
+	file.write(png.data(), png.size());
+	return (file.good());
+}
+
+/*
+** Private
+*/
+
+/*
+** Writer thread main loop, leaves when stopped and the queue is empty
+*/
+void Gbmu::Capture::_writerLoop (void)
+{
+	Slot*					slot;
+	std::ostringstream		path;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex>	lock(_mutex);
+
+			while (_count == 0 && _stop == false)
+				_notEmpty.wait(lock);
+			if (_count == 0)
+				return ;
+			slot = &_slots[_head];
+		}
+		if (slot->png)
+		{
+			path.str("");
+			path << _pngPrefix << "_" << std::setfill('0') << std::setw(6) << slot->frame << ".png";
+			if (writePng(path.str(), slot->pixels) == false)
+				std::cerr << "Capture: can't write " << path.str() << std::endl;
+		}
+		if (_stream)
+			this->_writeStream(slot->pixels);
+		{
+			std::lock_guard<std::mutex>	lock(_mutex);
+
+			_head = (_head + 1) % _slots.size();
+			_count--;
+		}
+		_notFull.notify_one();
+	}
+}
+
+/*
+** RAW: RGB24
+** Y4M: "FRAME" then Y, Cb, Cr planes ( BT.601 )
+*/
+void Gbmu::Capture::_writeStream (uint32_t const* pixels)
+{
+	size_t		size = SCREEN_WIDTH * SCREEN_HEIGHT;
+	int			r, g, b;
+
+	for (size_t i = 0; i < size; i++)
+	{
+		r = (pixels[i] >> 16) & 0xFF;
+		g = (pixels[i] >> 8) & 0xFF;
+		b = pixels[i] & 0xFF;
+		if (_format == RAW)
+		{
+			_buffer[i * 3] = r;
+			_buffer[i * 3 + 1] = g;
+			_buffer[i * 3 + 2] = b;
+		}
+		else
+		{
+			_buffer[i] = ((66 * r + 129 * g + 25 * b + 128) >> 8) + 16;
+			_buffer[size + i] = ((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128;
+			_buffer[size * 2 + i] = ((112 * r - 94 * g - 18 * b + 128) >> 8) + 128;
+		}
+	}
+	if (_format == Y4M)
+		fputs("FRAME\n", _stream);
+	fwrite(_buffer, 1, size * 3, _stream);
+}
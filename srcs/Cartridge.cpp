@@ -1,4 +1,7 @@
 #include "../includes/Cartridge.class.hpp"
+#include <stdexcept>
+#include <cstring>
+#include <algorithm>
 
 Gbmu::Cartridge::Cartridge (std::string const& path , Gb::Model const& model) :
 	_path(path)
@@ -9,14 +12,19 @@ Gbmu::Cartridge::Cartridge (std::string const& path , Gb::Model const& model) :
 
 Gbmu::Cartridge::Cartridge (Cartridge const & src)
 {
-	(void)src;
+	*this = src;
 }
 
 Gbmu::Cartridge::~Cartridge (void) {}
 
 Gbmu::Cartridge & Gbmu::Cartridge::operator=(Cartridge const & rhs)
 {
-	(void)rhs;
+	this->_path = rhs._path;
+	this->_model = rhs._model;
+	this->_rom = rhs._rom;
+	this->_data = rhs._data;
+	this->_size = rhs._size;
+	this->_header = rhs._header;
 	return *this;
 }
 
@@ -68,20 +76,41 @@ uint8_t *Gbmu::Cartridge::data (void) const
 	return (this->_data);
 }
 
+size_t const& Gbmu::Cartridge::size (void) const
+{
+	return (this->_size);
+}
+
 std::string const& Gbmu::Cartridge::path (void) const
 {
 	return (this->_path);
 }
 
-void Gbmu::Cartridge::saveState ( std::fstream& file)
+void Gbmu::Cartridge::saveState ( SaveState& state ) const
 {
-	(void)file;
-
+	state.begin("CART", 1);
+	state.put(_header.global_checksum);
+	state.put(_header.header_checksum);
+	state.write(_header.title, sizeof(_header.title));
+	state.end();
 }
 
-void Gbmu::Cartridge::loadState ( std::fstream& file)
+/*
+** Only accept the states of this game
+*/
+bool Gbmu::Cartridge::loadState ( SaveState& state )
 {
-	(void)file;
+	uint16_t	globalChecksum;
+	uint8_t		headerChecksum;
+	char		title[sizeof(_header.title)];
+
+	if (state.find("CART") == false)
+		return (true);
+	return (state.get(globalChecksum) && state.get(headerChecksum)
+		&& state.read(title, sizeof(title))
+		&& globalChecksum == _header.global_checksum
+		&& headerChecksum == _header.header_checksum
+		&& std::memcmp(title, _header.title, sizeof(title)) == 0);
 }
 
 /*
@@ -128,7 +157,10 @@ void						Gbmu::Cartridge::load ( void )
 	// Open the file in binary mode using the "rb" format string
 	// This also checks if the file exists and/or can be opened for reading correctly
 	if ((file = fopen(filePath, "rb")) == NULL)
+	{
 		std::cout << "Could not open specified file" << std::endl;
+		throw std::runtime_error("Could not open " + this->path());
+	}
 	else
 		std::cout << "File opened successfully" << std::endl;
 
@@ -136,7 +168,11 @@ void						Gbmu::Cartridge::load ( void )
 	fileSize = getFileSize(file);
 
 	// Allocate space in the buffer for the whole file
-	this->_data = new uint8_t[fileSize];
+	// at least the 32KB mapped, zeroed past the end of a smaller file
+	this->_rom.reset(new uint8_t[std::max(fileSize, static_cast<long>(CARTRIDGE_SIZE))](),
+		std::default_delete<uint8_t[]>());
+	this->_data = this->_rom.get();
+	this->_size = fileSize;
 
 	// Read the file in to the buffer
 	fread(this->_data, fileSize, 1, file);
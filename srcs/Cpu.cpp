@@ -1,27 +1,88 @@
 # include "../includes/Cpu.class.hpp"
+# include <new>
 
-Gbmu::Cpu::Cpu (void) :
-	_regs(new Gbmu::Registers),						// initialize registers
-	_memory(new Gbmu::Memory),						// initialize memory
+static_assert(sizeof(Gbmu::Registers) <= ARENA_BCP - ARENA_REGISTERS, "the registers overlap the palettes");
+
+Gbmu::Cpu::Cpu (bool const& sound) :
+	_arena(new Gbmu::StateArena),					// before everything living in it
+	_regs(new (_arena->at<void>(ARENA_REGISTERS)) Gbmu::Registers),	// initialize registers
+	_state(new (_arena->at<void>(ARENA_CPU)) State),				// BOOT and HALT flags
+	_memory(new Gbmu::Memory(this, _arena)),		// initialize memory
 	_cartridge(NULL),								// no cartridge is initially loaded
 	_instructions(new Gbmu::Instructions(this)),	// cpu instruction set
-	_BOOT(true),									// start the gameboy
-	_HALT(false)									// don't halt
-{}
+	_scheduler(new Gbmu::Scheduler(_arena)),		// clock, before the components scheduling on it
+	_interrupts(new Gbmu::Interrupts(this)),		// interrupt controller, before the components raising lines
+	_joypad(new Gbmu::Joypad(this)),				// P1 keys
+	_ppu(new Gbmu::Ppu(this)),						// pixel processing unit
+	_timer(new Gbmu::Timer(this)),					// DIV / TIMA timer
+	_apu(new Gbmu::Apu(this, sound))				// audio processing unit
+{
+	static_assert(sizeof(State) <= ARENA_JOYPAD - ARENA_CPU, "the cpu flags overlap the joypad");
+	_state->boot = true;							// start the gameboy
+	_state->halt = false;							// don't halt
+}
 
-Gbmu::Cpu::~Cpu (void) {}
+Gbmu::Cpu::~Cpu (void)
+{
+	delete _ppu;			// first, it may own a render thread
+	delete _apu;
+	delete _timer;
+	delete _scheduler;
+	delete _joypad;
+	delete _interrupts;
+	delete _instructions;
+	delete _cartridge;
+	delete _memory;
+	_regs->~Registers();
+	delete _arena;
+}
+
+/*
+** Back to the power on state, scheduler first: the components reschedule on it
+** The render thread is stopped meanwhile so it copies the fresh memory again
+*/
+void Gbmu::Cpu::reset ( void )
+{
+	bool		threaded = _ppu->threaded();
+	bool		color = _ppu->color();
+
+	_ppu->setThreaded(false);
+	_memory->reset();
+	_regs->setAF(0);
+	_regs->setBC(0);
+	_regs->setDE(0);
+	_regs->setHL(0);
+	_regs->setPC(DEFAULT_PC);
+	_regs->setSP(DEFAULT_SP);
+	_scheduler->reset();
+	_interrupts->reset();
+	_joypad->reset();
+	_ppu->reset();
+	_timer->reset();
+	_apu->reset();
+	_state->boot = true;
+	_state->halt = false;
+	if (_cartridge)
+		_ppu->setColor(color);
+	_ppu->setThreaded(threaded);
+}
 
 void Gbmu::Cpu::loadCartridge ( std::string const& cartridgePath, Gb::Model const& model )
 {
-	uint8_t		*data;
+	Cartridge	*cartridge = new Gbmu::Cartridge(cartridgePath, model);	// throws before anything changed
 
-	if (_cartridge)			// if a cartridge was already loaded
-		delete _cartridge;	// delete it
-	_cartridge = new Gbmu::Cartridge(cartridgePath, model);		// create new Cartridge object
-	data = _cartridge->data();
-	for (int addr = 0; addr < CARTRIDGE_SIZE; addr++) {
-		_memory->setByteAt(addr, data[addr]);
-	}
+	this->_insert(cartridge);
+	// CGB rendering when forced or when the cartridge supports it
+	_ppu->setColor(model == Gb::CGB ||
+			(model == Gb::Auto && (_cartridge->header().CGB_flag & 0x80)));
+}
+
+/*
+** The same game, its ROM shared with cartridge ( rendering stays as it is )
+*/
+void Gbmu::Cpu::loadCartridge ( Cartridge const& cartridge )
+{
+	this->_insert(new Gbmu::Cartridge(cartridge));
 }
 
 void Gbmu::Cpu::executeFrame(void) {
@@ -30,29 +91,224 @@ void Gbmu::Cpu::executeFrame(void) {
 	std::cout << "executeFrame at " << std::hex << _regs->getPC() << std::endl;
 	instruction = _memory->getByteAt(_regs->getPC());
 	std::cout << " instruction = " << std::hex << static_cast<uint16_t>(instruction) << std::endl;
-	_instructions->execute(instruction);
+	_scheduler->advance(this->execute());
+	_scheduler->dispatch();
+}
+
+/*
+** Execute the instruction at PC, or jump to a pending interrupt
+** Return the number of clock cycles it took
+*/
+size_t Gbmu::Cpu::execute(void) {
+	int			cycles;
+
+	if (_interrupts->pending() && (cycles = _interrupts->service()) > 0)
+		return (cycles);
+	if (_state->halt)
+		return (4);
+	cycles = _instructions->execute(_memory->getByteAt(_regs->getPC()));
+	return (cycles > 0 ? cycles : 4);	// undefined opcodes still take time
+}
+
+/*
+** Run instructions until the next event ( or limit ), then dispatch the due events
+** Nothing but the clock is checked between two instructions
+*/
+void Gbmu::Cpu::runSlice(uint64_t const& limit) {
+	if (_state->halt && !_interrupts->pending())	// nothing happens until the next event
+		_scheduler->advanceTo(std::min(_scheduler->deadline(), limit));
+	while (_scheduler->now() < _scheduler->deadline() && _scheduler->now() < limit)
+		_scheduler->advance(this->execute());
+	_scheduler->dispatch();
+}
+
+/*
+** One instruction ( or the halted time up to the next event ), then the due events
+** The clock goes exactly like runSlice, one instruction at a time
+*/
+void Gbmu::Cpu::step(void) {
+	if (_state->halt && !_interrupts->pending())
+		_scheduler->advanceTo(_scheduler->deadline());
+	else
+		_scheduler->advance(this->execute());
+	if (_scheduler->now() >= _scheduler->deadline())
+		_scheduler->dispatch();
+}
+
+/*
+** Run until the ppu completed a frame, with every sample of that frame rendered
+*/
+void Gbmu::Cpu::runFrame(void) {
+	uint64_t	frame = _ppu->frame();
+
+	while (_ppu->frame() == frame)
+		this->runSlice(NO_DEADLINE);
+	_apu->sync();
+}
+
+/*
+** Run at least cycles clock cycles, slice by slice
+*/
+uint64_t Gbmu::Cpu::runFor(uint64_t const& cycles) {
+	uint64_t	start = _scheduler->now();
+	uint64_t	end = this->_end(cycles);
+
+	while (_scheduler->now() < end)
+		this->runSlice(end);
+	return (_scheduler->now() - start);
+}
+
+/*
+** Same loop as runSlice, with the pc compared before each instruction
+** Return at once if the pc is already there
+*/
+bool Gbmu::Cpu::runUntilPc(uint16_t const& pc, uint64_t const& cycles) {
+	uint64_t	end = this->_end(cycles);
+
+	while (_scheduler->now() < end)
+	{
+		if (_state->halt && !_interrupts->pending())
+			_scheduler->advanceTo(std::min(_scheduler->deadline(), end));
+		while (_scheduler->now() < _scheduler->deadline() && _scheduler->now() < end)
+		{
+			if (_regs->getPC() == pc)
+				return (true);
+			_scheduler->advance(this->execute());
+		}
+		_scheduler->dispatch();
+	}
+	return (_regs->getPC() == pc);
+}
+
+void Gbmu::Cpu::runFrames(size_t const& frames) {
+	for (size_t i = 0; i < frames; i++)
+		this->runFrame();
+}
+
+/*
+** condition is called between slices, with data
+*/
+bool Gbmu::Cpu::runUntil(RunCondition condition, void *data, uint64_t const& cycles) {
+	uint64_t	end = this->_end(cycles);
+
+	while (_scheduler->now() < end)
+	{
+		if (condition(this, data))
+			return (true);
+		this->runSlice(end);
+	}
+	return (condition(this, data));
+}
+
+/*
+** Save states: the cartridge identity, then the arena as is
+*/
+void Gbmu::Cpu::saveState ( SaveState& state ) const
+{
+	if (_cartridge)
+		_cartridge->saveState(state);
+	_arena->saveState(state);
+}
+
+bool Gbmu::Cpu::loadState ( SaveState& state )
+{
+	if (_cartridge == NULL || _cartridge->loadState(state) == false)
+		return (false);
+	return (this->restore(state));
 }
 
-void Gbmu::Cpu::setHALT ( bool const& b ) { _HALT = b; }
+/*
+** The render thread drains its log first, then sleeps while the memory changes
+*/
+bool Gbmu::Cpu::restore ( SaveState& state )
+{
+	_ppu->flush();
+	if (_arena->loadState(state) == false)
+		return (false);
+	this->_restored();
+	return (true);
+}
+
+bool Gbmu::Cpu::attach ( int const& fd )
+{
+	_ppu->flush();
+	if (_arena->attach(fd) == false)
+		return (false);
+	this->_restored();
+	return (true);
+}
+
+void Gbmu::Cpu::setHALT ( bool const& b ) { _state->halt = b; }
 
 void Gbmu::Cpu::stopBOOT ( void )
 {
-	//		this->_BOOT = false;
+	//		this->_state->boot = false;
 }
 
 bool const& Gbmu::Cpu::onHalt ( void ) const
 {
-	return (this->_HALT);
+	return (this->_state->halt);
 }
 
 bool const& Gbmu::Cpu::onBoot ( void ) const
 {
-	return (this->_BOOT);
+	return (this->_state->boot);
 }
 
 Gbmu::Memory		*Gbmu::Cpu::memory(void) const { return (this->_memory); }
 
 Gbmu::Cartridge		*Gbmu::Cpu::cartridge(void) const { return (this->_cartridge); }
 
+Gbmu::Instructions	*Gbmu::Cpu::instructions(void) const { return (_instructions); }
+
 Gbmu::Registers		*Gbmu::Cpu::regs(void) const { return (_regs); }
 
+Gbmu::StateArena	*Gbmu::Cpu::arena(void) const { return (_arena); }
+
+Gbmu::Ppu			*Gbmu::Cpu::ppu(void) const { return (_ppu); }
+
+Gbmu::Scheduler		*Gbmu::Cpu::scheduler(void) const { return (_scheduler); }
+
+Gbmu::Timer			*Gbmu::Cpu::timer(void) const { return (_timer); }
+
+Gbmu::Interrupts	*Gbmu::Cpu::interrupts(void) const { return (_interrupts); }
+
+Gbmu::Joypad		*Gbmu::Cpu::joypad(void) const { return (_joypad); }
+
+Gbmu::Apu			*Gbmu::Cpu::apu(void) const { return (_apu); }
+
+/*
+** Private
+*/
+
+/*
+** Clock cycle cycles from now, NO_DEADLINE when it would overflow
+*/
+uint64_t Gbmu::Cpu::_end(uint64_t const& cycles) const {
+	uint64_t	now = _scheduler->now();
+
+	return (cycles > NO_DEADLINE - now ? NO_DEADLINE : now + cycles);
+}
+
+void Gbmu::Cpu::_insert ( Cartridge *cartridge )
+{
+	if (_cartridge)			// if a cartridge was already loaded
+	{
+		_memory->setRom(NULL);
+		delete _cartridge;	// delete it
+		_cartridge = NULL;
+		this->reset();		// and start the new one from power on
+	}
+	_cartridge = cartridge;
+	_memory->setRom(_cartridge->data());
+}
+
+/*
+** The arena was overwritten, what the components derive from their state follows
+*/
+void Gbmu::Cpu::_restored ( void )
+{
+	_memory->remap();
+	_ppu->onRestore();
+	_apu->onRestore();
+}
@@ -0,0 +1,117 @@
+#include "../includes/FramePacer.class.hpp"
+#include <time.h>
+#include <errno.h>
+
+Gbmu::FramePacer::FramePacer (double const& speed)
+{
+	_stats.fps = 0;
+	_stats.jitterMean = 0;
+	_stats.jitterMax = 0;
+	this->setSpeed(speed);
+}
+
+Gbmu::FramePacer::~FramePacer (void) {}
+
+/*
+** speed 0 ( or less ) is unlimited
+*/
+void Gbmu::FramePacer::setSpeed (double const& speed)
+{
+	_speed = speed > 0 ? speed : 0;
+	_period = _speed > 0 ? 1e9 / (GB_FPS * _speed) : 0;
+	this->restart();
+}
+
+double const& Gbmu::FramePacer::speed (void) const
+{
+	return (_speed);
+}
+
+/*
+** Next frame deadline is one period from now
+*/
+void Gbmu::FramePacer::restart (void)
+{
+	_base = now();
+	_frames = 0;
+	_windowStart = _base;
+	_windowFrames = 0;
+	_lateSum = 0;
+	_lateMax = 0;
+}
+
+/*
+** Called once a frame is done, return at its deadline
+*/
+void Gbmu::FramePacer::wait (void)
+{
+	int64_t			deadline;
+	int64_t			t = now();
+	struct timespec	wake;
+
+	if (_speed == 0)
+	{
+		this->_count(t, 0);
+		return ;
+	}
+	deadline = _base + static_cast<int64_t>(++_frames * _period);
+	if (t > deadline + PACER_MAX_LATE_NS)
+	{
+		_base = t;
+		_frames = 0;
+		this->_count(t, 0);
+		return ;
+	}
+	if (deadline - t > PACER_SPIN_NS)
+	{
+		wake.tv_sec = (deadline - PACER_SPIN_NS) / 1000000000;
+		wake.tv_nsec = (deadline - PACER_SPIN_NS) % 1000000000;
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL) == EINTR)
+			;
+	}
+	while ((t = now()) < deadline)
+		;
+	this->_count(t, t - deadline);
+}
+
+Gbmu::FramePacer::Stats Gbmu::FramePacer::stats (void) const
+{
+	Stats	partial;
+	int64_t	elapsed = now() - _windowStart;
+
+	if (_stats.fps > 0 || _windowFrames == 0 || elapsed <= 0)
+		return (_stats);
+	partial.fps = _windowFrames * 1e9 / elapsed;
+	partial.jitterMean = _lateSum / 1e3 / _windowFrames;
+	partial.jitterMax = _lateMax / 1e3;
+	return (partial);
+}
+
+int64_t Gbmu::FramePacer::now (void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec);
+}
+
+/*
+** Private
+*/
+
+void Gbmu::FramePacer::_count (int64_t const& now, int64_t const& late)
+{
+	_windowFrames++;
+	_lateSum += late;
+	if (late > _lateMax)
+		_lateMax = late;
+	if (now - _windowStart < 1000000000)
+		return ;
+	_stats.fps = _windowFrames * 1e9 / (now - _windowStart);
+	_stats.jitterMean = _lateSum / 1e3 / _windowFrames;
+	_stats.jitterMax = _lateMax / 1e3;
+	_windowStart = now;
+	_windowFrames = 0;
+	_lateSum = 0;
+	_lateMax = 0;
+}
@@ -1,12 +1,37 @@
 # include "../includes/Gb.class.hpp"
 # include "../includes/Cpu.class.hpp"
+# include "../includes/AudioOutput.class.hpp"
+# include "../includes/FramePacer.class.hpp"
+# include "../includes/Rewind.class.hpp"
+# include "../includes/Movie.class.hpp"
+# include "../includes/StateIndex.class.hpp"
+# include <chrono>
+# include <unistd.h>
 
-Gbmu::Gb::Gb (void) :
-	_cpu(new Gbmu::Cpu)
+Gbmu::Gb::Gb (bool const& sound) :
+	_cpu(new Gbmu::Cpu(sound)),
+	_audio(new Gbmu::AudioOutput(_cpu->apu())),
+	_pacer(new Gbmu::FramePacer),
+	_state(new Gbmu::SaveState),
+	_rewind(NULL),
+	_rewindInterval(REWIND_INTERVAL),
+	_sinceCapture(0),
+	_movie(new Gbmu::Movie),
+	_thread(NULL),
+	_play(false),
+	_loaded(false),
+	_running(false),
+	_frames(0),
+	_done(0),
+	_errors(0),
+	_pc(0),
+	_reached(false),
+	_movieOn(false),
+	_buttons(0)
 {
 	this->setModel(Auto);
 	this->_cpu->setHALT(false);
-	this->_run();
+	this->setSpeed(1);		// same frame rate on DMG and CGB
 }
 
 Gbmu::Gb::Gb (Gb const & src)
@@ -16,6 +41,13 @@ Gbmu::Gb::Gb (Gb const & src)
 
 Gbmu::Gb::~Gb (void)
 {
+	this->stop();
+	this->_stopMovie();
+	delete this->_audio;		// first, its thread reads the apu
+	delete this->_pacer;
+	delete this->_state;
+	delete this->_rewind;
+	delete this->_movie;
 	delete this->_cpu;
 }
 
@@ -26,22 +58,162 @@ Gbmu::Gb & Gbmu::Gb::operator=(Gb const & rhs)
 }
 
 /*
-** Load a cartridge
+** Emulation thread, commands queued before start() run at once
 */
 
+void Gbmu::Gb::start (void)
+{
+	if (this->_thread)
+		return ;
+	this->_thread = new std::thread(&Gbmu::Gb::_run, this);
+}
+
+void Gbmu::Gb::stop (void)
+{
+	if (this->_thread == NULL)
+		return ;
+	this->_post(Command::QUIT);
+	this->_thread->join();
+	delete this->_thread;
+	this->_thread = NULL;
+}
+
+/*
+** Load a cartridge
+*/
 
 void Gbmu::Gb::load (std::string const& cartridgePath)
 {
-	std::cout << "GB LOAD" << std::endl;
-	this->_cpu->loadCartridge(cartridgePath, Auto);
-	if (this->_cpu->onBoot() == true &&
-			this->_cpu->onHalt() == false)
+	this->_post(Command::LOAD, cartridgePath);
+}
+
+bool Gbmu::Gb::saveState (std::string const& path, StateCodec::Codec const& codec, int const& level)
+{
+	Command		command;
+
+	if (StateCodec::available(codec) == false)
+		return (false);
+	command.type = Command::SAVE_STATE;
+	command.path = path;
+	command.codec = codec;
+	command.count = level;
+	return (this->_post(command));
+}
+
+bool Gbmu::Gb::loadState (std::string const& path)
+{
+	return (this->_post(Command::LOAD_STATE, path));
+}
+
+bool Gbmu::Gb::snapshot (Snapshot& blob)
+{
+	Command		command;
+
+	command.type = Command::SNAPSHOT;
+	command.data = &blob;
+	return (this->_call(command));
+}
+
+bool Gbmu::Gb::restore (Snapshot& blob)
+{
+	Command		command;
+
+	command.type = Command::RESTORE;
+	command.data = &blob;
+	return (this->_call(command));
+}
+
+bool Gbmu::Gb::recordMovie (std::string const& path)
+{
+	return (this->_post(Command::MOVIE_RECORD, path));
+}
+
+bool Gbmu::Gb::playMovie (std::string const& path)
+{
+	return (this->_post(Command::MOVIE_PLAY, path));
+}
+
+bool Gbmu::Gb::stopMovie (void)
+{
+	return (this->_post(Command::MOVIE_STOP));
+}
+
+/*
+** The branches are built here, filled between two frames of the thread
+** The thread always replies, a command that threw included
+*/
+std::vector<Gbmu::Gb*> Gbmu::Gb::fork (size_t const& k)
+{
+	Command		command;
+	bool		ok;
+
+	command.type = Command::FORK;
+	try
 	{
-		this->_play = true;
+		for (size_t i = 0; i < k; i++)
+			command.branches.push_back(new Gbmu::Gb(this->_cpu->apu()->sound()));
+		ok = this->_call(command);
 	}
-	else
-		std::cout << "Boot status: Failed" << std::endl; // Check if it's correct
-	//	this->isLoaded();
+	catch (...)				// without the thread, the command throws here
+	{
+		ok = false;
+	}
+	if (ok == false)
+	{
+		for (size_t i = 0; i < command.branches.size(); i++)
+			delete command.branches[i];
+		command.branches.clear();
+	}
+	return (command.branches);
+}
+
+bool Gbmu::Gb::boot (std::string const& cacheDir, BootCache::Trigger const& trigger, uint64_t const& at)
+{
+	Command		command;
+
+	command.type = Command::BOOT;
+	command.path = cacheDir;
+	command.trigger = trigger;
+	command.count = at;
+	return (this->_post(command));
+}
+
+/*
+** Completed frames are sent to the screen
+*/
+
+void Gbmu::Gb::setScreen (IScreen* screen)
+{
+	this->_cpu->ppu()->setScreen(screen);
+}
+
+void Gbmu::Gb::setHashLog (HashLog* log)
+{
+	this->_cpu->ppu()->setHashLog(log);
+}
+
+bool Gbmu::Gb::setAudioSink (IAudioSink* sink)
+{
+	if (sink == NULL)
+	{
+		this->_cpu->apu()->sync();
+		this->_audio->stop();
+		return (true);
+	}
+	return (this->_audio->start(sink));
+}
+
+void Gbmu::Gb::setRenderThread (bool const& b)
+{
+	this->_cpu->ppu()->setThreaded(b);
+}
+
+void Gbmu::Gb::setRewind (size_t const& memory, size_t const& interval)
+{
+	delete this->_rewind;
+	this->_rewind = memory > 0 ? new Gbmu::Rewind(memory) : NULL;
+	this->_rewindInterval = interval > 0 ? interval : 1;
+	this->_sinceCapture = 0;
 }
 
 /* 
@@ -59,25 +231,132 @@ void Gbmu::Gb::setModel (Gbmu::Gb::Model const& model)
 
 void Gbmu::Gb::play (void)
 {
-	//If Interact with Gui interface button
-	//	if
-	this->_play = true;
-
-	//Cpu launch executeframe
+	this->_post(Command::PLAY);
 }
 
 void Gbmu::Gb::pause (void)
 {
-	//If Interact with Gui interface button
-	this->_play = false;
+	this->_post(Command::PAUSE);
+}
 
-	//Cpu stop executeframe
+void Gbmu::Gb::step (void)
+{
+	this->runFor(1);
+}
+
+bool Gbmu::Gb::runFor (uint64_t const& cycles)
+{
+	Command		command;
+
+	command.type = Command::RUN_FOR;
+	command.count = cycles;
+	return (this->_post(command));
+}
+
+bool Gbmu::Gb::runUntilPc (uint16_t const& pc, uint64_t const& cycles)
+{
+	Command		command;
 
+	command.type = Command::RUN_UNTIL_PC;
+	command.pc = pc;
+	command.count = cycles;
+	return (this->_post(command));
 }
 
-void Gbmu::Gb::setSpeed(size_t const& speed)
+bool Gbmu::Gb::runFrames (size_t const& frames)
 {
-	(void)speed; // TODO
+	Command		command;
+
+	command.type = Command::RUN_FRAMES;
+	command.count = frames;
+	return (this->_post(command));
+}
+
+bool Gbmu::Gb::runUntil (RunCondition condition, void *data, uint64_t const& cycles)
+{
+	Command		command;
+
+	command.type = Command::RUN_UNTIL;
+	command.condition = condition;
+	command.data = data;
+	command.count = cycles;
+	return (this->_post(command));
+}
+
+void Gbmu::Gb::reset (void)
+{
+	this->_post(Command::RESET);
+}
+
+bool Gbmu::Gb::rewind (void)
+{
+	return (this->_post(Command::REWIND));
+}
+
+void Gbmu::Gb::setSpeed (double const& speed)
+{
+	this->_post(Command::SPEED, "", speed);
+}
+
+void Gbmu::Gb::runFrame (void)
+{
+	this->_cpu->joypad()->setButtons(this->_movie->input(this->_buttons.load(std::memory_order_relaxed)));
+	this->_cpu->runFrame();
+	if (this->_rewind && ++this->_sinceCapture >= this->_rewindInterval)
+	{
+		this->_sinceCapture = 0;
+		this->_state->clear();
+		this->_cpu->saveState(*this->_state);
+		this->_rewind->push(*this->_state);
+	}
+	this->_frames.fetch_add(1, std::memory_order_relaxed);
+	this->_pc.store(this->_cpu->regs()->getPC(), std::memory_order_relaxed);
+	this->_movieOn.store(this->_movie->mode() != Movie::NONE, std::memory_order_relaxed);
+	this->_pacer->wait();
+}
+
+void Gbmu::Gb::mute (bool const& b)
+{
+	this->_cpu->apu()->setMuted(b);
+}
+
+void Gbmu::Gb::setButtons (uint8_t const& buttons)
+{
+	this->_buttons.store(buttons, std::memory_order_relaxed);
+}
+
+/*
+** Debugger
+*/
+
+bool Gbmu::Gb::inspect (Inspection& view)
+{
+	Command		command;
+
+	view.ready.store(false);
+	command.type = Command::INSPECT;
+	command.data = &view;
+	return (this->_post(command));
+}
+
+bool Gbmu::Gb::setRegister (Register const& reg, uint16_t const& value)
+{
+	Command		command;
+
+	command.type = Command::SET_REGISTER;
+	command.pc = reg;
+	command.count = value;
+	return (this->_post(command));
+}
+
+bool Gbmu::Gb::poke (uint16_t const& addr, uint8_t const& value)
+{
+	Command		command;
+
+	command.type = Command::POKE;
+	command.pc = addr;
+	command.count = value;
+	return (this->_post(command));
 }
 
 /*
@@ -86,12 +365,41 @@ void Gbmu::Gb::setSpeed(size_t const& speed)
 
 bool Gbmu::Gb::isLoaded (void) const
 {
-	return (false);
+	return (this->_loaded.load());
 }
 
 bool Gbmu::Gb::isRunning (void) const
 {
-	return (false);
+	return (this->_running.load());
+}
+
+Gbmu::Gb::Status Gbmu::Gb::status (void) const
+{
+	Status		status;
+
+	status.loaded = this->_loaded.load();
+	status.running = this->_running.load();
+	status.frames = this->_frames.load(std::memory_order_relaxed);
+	status.commands = this->_done.load();
+	status.errors = this->_errors.load();
+	status.pc = this->_pc.load(std::memory_order_relaxed);
+	status.reached = this->_reached.load();
+	status.movie = this->_movieOn.load(std::memory_order_relaxed);
+	return (status);
+}
+
+double const& Gbmu::Gb::speed (void) const
+{
+	return (this->_pacer->speed());
+}
+
+void Gbmu::Gb::pacing (double& fps, double& jitterMean, double& jitterMax) const
+{
+	Gbmu::FramePacer::Stats	stats = this->_pacer->stats();
+
+	fps = stats.fps;
+	jitterMean = stats.jitterMean;
+	jitterMax = stats.jitterMax;
 }
 
 Gbmu::Gb::Model Gbmu::Gb::model (void) const
@@ -112,13 +420,411 @@ Gbmu::Cpu * Gbmu::Gb::cpu(void) const {
 ** Private
 */
 
+/*
+** Emulation thread: commands are applied between frames
+*/
 void Gbmu::Gb::_run (void)
 {
-	//	bool value = false;//Get the Gui button play, if play so HALT false
+	Command		command;
+
+	while (true)
+	{
+		while (this->_commands.pop(command))
+		{
+			if (command.type == Command::QUIT)
+			{
+				while (this->_commands.pop(command))	// posted while stopping
+					this->_reply(command, false);
+				return ;
+			}
+			try
+			{
+				this->_execute(command);
+			}
+			catch (std::exception& e)
+			{
+				std::cerr << "Gb: " << e.what() << std::endl;
+				this->_errors++;
+				this->_done++;
+				this->_reply(command, false);
+			}
+		}
+		if (this->_play)
+			this->runFrame();
+		else
+			std::this_thread::sleep_for(std::chrono::milliseconds(GB_IDLE_MS));
+	}
+}
+
+/*
+** Queue the command for the thread, or run it now without one
+** A full queue waits like the paused thread polls
+*/
+bool Gbmu::Gb::_post (Command& command)
+{
+	if (this->_thread)
+	{
+		while (this->_commands.push(command) == false)
+			std::this_thread::sleep_for(std::chrono::milliseconds(GB_IDLE_MS));
+		return (true);
+	}
+	return (this->_execute(command));
+}
 
-	if (this->model() == DMG)
-		this->_speed = 1;
-	else if (this->model() == CGB)
-		this->_speed = 1;
-	this->play();
+bool Gbmu::Gb::_post (Command::Type const& type, std::string const& path, double const& speed)
+{
+	Command		command;
+
+	command.type = type;
+	command.path = path;
+	command.speed = speed;
+	return (this->_post(command));
+}
+
+/*
+** Queue the command and sleep until it ran, its result
+*/
+bool Gbmu::Gb::_call (Command& command)
+{
+	Reply							reply;
+	std::unique_lock<std::mutex>	guard(reply.lock, std::defer_lock);
+
+	reply.result = 0;
+	command.reply = &reply;
+	this->_post(command);
+	guard.lock();
+	while (reply.result == 0)
+		reply.done.wait(guard);
+	return (reply.result > 0);
+}
+
+bool Gbmu::Gb::_execute (Command const& command)
+{
+	bool		ok = true;
+
+	switch (command.type)
+	{
+		case Command::LOAD:
+			std::cout << "GB LOAD" << std::endl;
+			this->_play = false;		// the previous game stays paused if it fails
+			this->_running = false;
+			this->_cpu->loadCartridge(command.path, Auto);
+			this->_loaded = true;
+			this->_play = this->_cpu->onBoot() == true && this->_cpu->onHalt() == false;
+			if (this->_play == false)
+				std::cout << "Boot status: Failed" << std::endl; // Check if it's correct
+			this->_pacer->restart();
+			break ;
+		case Command::PLAY:
+			this->_play = this->_loaded;
+			this->_pacer->restart();	// no catching up on the paused time
+			break ;
+		case Command::PAUSE:
+			this->_play = false;
+			break ;
+		case Command::RUN_FOR:
+			this->_play = false;
+			this->_cpu->runFor(command.count);
+			this->_reached = true;
+			break ;
+		case Command::RUN_UNTIL_PC:
+			this->_play = false;
+			this->_reached = this->_cpu->runUntilPc(command.pc, command.count);
+			ok = this->_reached;
+			break ;
+		case Command::RUN_FRAMES:
+			this->_play = false;
+			this->_cpu->runFrames(command.count);
+			this->_frames.fetch_add(command.count, std::memory_order_relaxed);
+			this->_reached = true;
+			break ;
+		case Command::RUN_UNTIL:
+			this->_play = false;
+			this->_reached = this->_cpu->runUntil(command.condition, command.data, command.count);
+			ok = this->_reached;
+			break ;
+		case Command::RESET:
+			this->_cpu->reset();
+			break ;
+		case Command::SPEED:
+			this->_pacer->setSpeed(command.speed);
+			break ;
+		case Command::SAVE_STATE:
+			ok = this->_saveState(command.path, command.codec, command.count);
+			break ;
+		case Command::LOAD_STATE:
+			ok = this->_loadState(command.path);
+			break ;
+		case Command::SNAPSHOT:
+			static_cast<Snapshot*>(command.data)->clear();
+			this->_cpu->saveState(*static_cast<Snapshot*>(command.data));
+			break ;
+		case Command::RESTORE:
+			ok = this->_cpu->restore(*static_cast<Snapshot*>(command.data));
+			break ;
+		case Command::REWIND:
+			ok = this->_rewind && this->_rewind->back(*this->_state)
+				&& this->_cpu->restore(*this->_state);
+			this->_sinceCapture = 0;
+			break ;
+		case Command::MOVIE_RECORD:
+			ok = this->_recordMovie(command.path);
+			break ;
+		case Command::MOVIE_PLAY:
+			ok = this->_playMovie(command.path);
+			break ;
+		case Command::MOVIE_STOP:
+			ok = this->_stopMovie();
+			break ;
+		case Command::FORK:
+			ok = this->_fork(command.branches);
+			break ;
+		case Command::BOOT:
+			this->_play = false;
+			ok = this->_boot(command.path, command.trigger, command.count);
+			break ;
+		case Command::INSPECT:
+			this->_inspect(*static_cast<Inspection*>(command.data));
+			break ;
+		case Command::SET_REGISTER:
+			ok = this->_setRegister(static_cast<Register>(command.pc), command.count);
+			break ;
+		case Command::POKE:
+			this->_cpu->memory()->setByteAt(command.pc, static_cast<uint8_t>(command.count));
+			break ;
+		case Command::QUIT:
+			break ;
+	}
+	this->_running = this->_play;
+	this->_movieOn = this->_movie->mode() != Movie::NONE;
+	this->_pc.store(this->_cpu->regs()->getPC(), std::memory_order_relaxed);
+	if (ok == false)
+		this->_errors++;
+	this->_done++;
+	this->_reply(command, ok);
+	return (ok);
+}
+
+/*
+** Notified under the lock: the caller cannot return before the unlock
+*/
+void Gbmu::Gb::_reply (Command const& command, bool const& ok)
+{
+	if (command.reply == NULL)
+		return ;
+	std::lock_guard<std::mutex>		guard(command.reply->lock);
+
+	command.reply->result = ok ? 1 : -1;
+	command.reply->done.notify_one();
+}
+
+/*
+** The Info first, then the ROM index next to the state is brought up to date
+*/
+bool Gbmu::Gb::_saveState (std::string const& path, StateCodec::Codec const& codec, int const& level)
+{
+	Cartridge				*cartridge = this->_cpu->cartridge();
+	StateIndex::Info		info;
+
+	this->_state->clear();
+	if (cartridge)
+	{
+		StateIndex::describe(info, cartridge->title(), cartridge->header().global_checksum,
+			this->_frames.load(), this->_cpu->ppu()->frameBuffer());
+		StateIndex::write(*this->_state, info);
+	}
+	this->_cpu->saveState(*this->_state);
+	if (StateCodec::save(*this->_state, path, codec, level) == false)
+		return (false);
+	if (cartridge && StateIndex::add(StateIndex::indexPath(path, info), path, info) == false)
+		std::cerr << "Gb: cannot index " << path << std::endl;
+	return (true);
+}
+
+bool Gbmu::Gb::_loadState (std::string const& path)
+{
+	return (StateCodec::load(*this->_state, path) && this->_cpu->loadState(*this->_state));
+}
+
+/*
+** The movie starts from a snapshot, keys included
+*/
+bool Gbmu::Gb::_recordMovie (std::string const& path)
+{
+	Cartridge	*cartridge = this->_cpu->cartridge();
+
+	if (cartridge == NULL || this->_stopMovie() == false)
+		return (false);
+	this->_movie->state().clear();
+	this->_cpu->saveState(this->_movie->state());
+	this->_movie->record(HashLog::hash(cartridge->data(), cartridge->size()));
+	this->_moviePath = path;
+	return (true);
+}
+
+bool Gbmu::Gb::_playMovie (std::string const& path)
+{
+	Cartridge	*cartridge = this->_cpu->cartridge();
+
+	this->_stopMovie();
+	if (cartridge == NULL || this->_movie->load(path) == false
+		|| this->_movie->romHash() != HashLog::hash(cartridge->data(), cartridge->size())
+		|| this->_cpu->loadState(this->_movie->state()) == false)
+		return (false);
+	this->_movie->play();
+	this->_sinceCapture = 0;
+	return (true);
+}
+
+/*
+** A recording is written, false if it could not be
+*/
+bool Gbmu::Gb::_stopMovie (void)
+{
+	bool		ok = true;
+
+	if (this->_movie->mode() == Movie::RECORD)
+		ok = this->_movie->save(this->_moviePath);
+	this->_movie->stop();
+	return (ok);
+}
+
+/*
+** The arena is shared once, each branch maps it
+*/
+bool Gbmu::Gb::_fork (std::vector<Gb*> const& branches)
+{
+	Cartridge	*cartridge = this->_cpu->cartridge();
+	Gb			*branch;
+	int			fd;
+	bool		ok = true;
+
+	if (cartridge == NULL || (fd = this->_cpu->arena()->share()) < 0)
+		return (false);
+	try
+	{
+		for (size_t i = 0; ok && i < branches.size(); i++)
+		{
+			branch = branches[i];
+			branch->_model = this->_model;
+			branch->_cpu->loadCartridge(*cartridge);
+			ok = branch->_cpu->attach(fd);
+			branch->_pacer->setSpeed(this->_pacer->speed());
+			branch->_buttons.store(this->_buttons.load());
+			branch->_loaded = true;
+			branch->_frames.store(this->_frames.load());
+			branch->_pc.store(this->_pc.load());
+		}
+	}
+	catch (...)
+	{
+		close(fd);
+		throw ;
+	}
+	close(fd);
+	return (ok);
+}
+
+/*
+** A hit loads the mapped state, a miss runs like RUN_FRAMES / RUN_UNTIL_PC
+** then records the state for the next runs ( false if it cannot )
+*/
+bool Gbmu::Gb::_boot (std::string const& cacheDir, BootCache::Trigger const& trigger, uint64_t const& at)
+{
+	Cartridge			*cartridge = this->_cpu->cartridge();
+	BootCache			cache;
+	BootCache::Key		key;
+	std::string			path;
+	uint64_t			frame;
+	bool				reached;
+
+	if (cartridge == NULL)
+		return (false);
+	key.checksum = cartridge->header().global_checksum;
+	key.model = this->_model;
+	key.trigger = trigger;
+	key.type = cartridge->header().cartridge_type;
+	key.romSize = cartridge->header().rom_size;
+	key.at = at;
+	path = BootCache::path(cacheDir, cartridge->title(), key);
+	if (cache.open(path, key))
+	{
+		if (this->_state->assign(cache.state(), cache.size()) && this->_cpu->loadState(*this->_state))
+		{
+			this->_frames.store(cache.frames());
+			return (true);
+		}
+		this->_cpu->reset();		// damaged, recorded again
+	}
+	if (trigger == BootCache::PC)
+	{
+		frame = this->_cpu->ppu()->frame();
+		reached = this->_cpu->runUntilPc(at, BOOTCACHE_PC_CYCLES);
+		this->_frames.fetch_add(this->_cpu->ppu()->frame() - frame, std::memory_order_relaxed);
+		if (reached == false)
+			return (false);
+	}
+	else
+	{
+		this->_cpu->runFrames(at);
+		this->_frames.fetch_add(at, std::memory_order_relaxed);
+	}
+	this->_state->clear();
+	this->_cpu->saveState(*this->_state);
+	if (BootCache::write(path, key, this->_frames.load(), *this->_state) == false)
+	{
+		std::cerr << "Gb: cannot write the boot cache " << path << std::endl;
+		return (false);
+	}
+	return (true);
+}
+
+/*
+** The commands count includes this one, done right after
+*/
+void Gbmu::Gb::_inspect (Inspection& view)
+{
+	Registers	*regs = this->_cpu->regs();
+	Memory		*memory = this->_cpu->memory();
+
+	view.registers[AF] = regs->getAF();
+	view.registers[BC] = regs->getBC();
+	view.registers[DE] = regs->getDE();
+	view.registers[HL] = regs->getHL();
+	view.registers[SP] = regs->getSP();
+	view.registers[PC] = regs->getPC();
+	for (size_t addr = 0; addr < sizeof(view.memory); addr++)
+		view.memory[addr] = memory->getByteAt(addr);
+	view.commands = this->_done.load() + 1;
+	view.ready.store(true);
+}
+
+bool Gbmu::Gb::_setRegister (Register const& reg, uint16_t const& value)
+{
+	Registers	*regs = this->_cpu->regs();
+
+	switch (reg)
+	{
+		case AF:
+			regs->setAF(value);
+			break ;
+		case BC:
+			regs->setBC(value);
+			break ;
+		case DE:
+			regs->setDE(value);
+			break ;
+		case HL:
+			regs->setHL(value);
+			break ;
+		case SP:
+			regs->setSP(value);
+			break ;
+		case PC:
+			regs->setPC(value);
+			break ;
+		default:
+			return (false);
+	}
+	return (true);
 }
@@ -0,0 +1,181 @@
+#include "../includes/HashLog.class.hpp"
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+
+# define PRIME32_1	0x9E3779B1U
+# define PRIME64_1	0x9E3779B185EBCA87ULL
+# define PRIME64_2	0xC2B2AE3D27D4EB4FULL
+# define PRIME64_3	0x165667B19E3779F9ULL
+
+/*
+** Lane keys, one per 64 bits lane of a stripe
+*/
+static const uint64_t	g_keys[8] = {
+	0xBE4BA423396CFEB8ULL, 0x1CAD21F72C81017CULL,
+	0xDB979083E96DD4DEULL, 0x1F67B3B7A4A44072ULL,
+	0x78E5C0CC4EE679CBULL, 0x2172FFCC7DD05A82ULL,
+	0x8E2443F7744608B8ULL, 0x4C263A81E69035E0ULL
+};
+
+Gbmu::HashLog::HashLog (void) :
+	_frames(0)
+{
+}
+
+Gbmu::HashLog::~HashLog (void)
+{
+	this->close();
+}
+
+/*
+** Create the log and write its header
+*/
+bool Gbmu::HashLog::open (std::string const& path)
+{
+	uint32_t	version = HASHLOG_VERSION;
+
+	_file.open(path.c_str(), std::ios::binary | std::ios::trunc);
+	if (!_file)
+		return (false);
+	_file.write(HASHLOG_MAGIC, 4);
+	_file.write(reinterpret_cast<char const*>(&version), sizeof(version));
+	_frames = 0;
+	return (_file.good());
+}
+
+void Gbmu::HashLog::close (void)
+{
+	if (_file.is_open())
+		_file.close();
+}
+
+void Gbmu::HashLog::append (uint64_t const& hash)
+{
+	_file.write(reinterpret_cast<char const*>(&hash), sizeof(hash));
+	_frames++;
+}
+
+uint64_t Gbmu::HashLog::frames (void) const
+{
+	return (_frames);
+}
+
+static uint64_t		avalanche(uint64_t h)
+{
+	h ^= h >> 37;
+	h *= 0x165667919E3779F9ULL;
+	h ^= h >> 32;
+	return (h);
+}
+
+static uint64_t		mulFold(uint64_t a, uint64_t b)
+{
+	__uint128_t		product = static_cast<__uint128_t>(a) * b;
+
+	return (static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64));
+}
+
+/**
+ * 64 bits hash of a buffer
+ * Each 64 bytes stripe feeds 8 lanes: acc[i] += lo32(d ^ k) * hi32(d ^ k), acc[i ^ 1] += d
+ * Lanes are scrambled every 1KB and folded together at the end
+ *
+ * @param data - bytes to hash
+ * @param size - number of bytes
+ */
+uint64_t Gbmu::HashLog::hash (void const* data, size_t const& size)
+{
+	uint8_t const*	p = static_cast<uint8_t const*>(data);
+	uint64_t		acc[8] = {
+		PRIME32_1, PRIME64_1, PRIME64_2, PRIME64_3,
+		PRIME64_2, PRIME32_1, PRIME64_3, PRIME64_1
+	};
+	uint64_t		lane[8];
+	uint64_t		dk;
+	uint64_t		h;
+	size_t			stripes = size / 64;
+	size_t			i;
+
+	for (size_t s = 0; s < stripes; s++)
+	{
+		std::memcpy(lane, p + s * 64, 64);
+		for (i = 0; i < 8; i++)
+		{
+			dk = lane[i] ^ g_keys[i];
+			acc[i ^ 1] += lane[i];
+			acc[i] += (dk & 0xFFFFFFFF) * (dk >> 32);
+		}
+		if ((s & 15) == 15)							// scramble every 16 stripes
+		{
+			for (i = 0; i < 8; i++)
+				acc[i] = ((acc[i] ^ (acc[i] >> 47)) ^ g_keys[i]) * PRIME32_1;
+		}
+	}
+	h = size * PRIME64_1;
+	for (i = 0; i < 8; i += 2)
+		h += mulFold(acc[i] ^ g_keys[i], acc[i + 1] ^ g_keys[i + 1]);
+	for (i = stripes * 64; i < size; i++)			// tail bytes
+		h = (h ^ (p[i] * PRIME64_3)) * PRIME64_1;
+	return (avalanche(h));
+}
+
+/*
+** Read the hashes of a log ( 8 bytes per frame ) in hashes
+*/
+bool Gbmu::HashLog::load (std::string const& path, std::string& hashes)
+{
+	std::ifstream	file(path.c_str(), std::ios::binary);
+	char			header[8];
+	uint32_t		version;
+
+	if (!file || !file.read(header, sizeof(header)) || std::memcmp(header, HASHLOG_MAGIC, 4))
+		return (false);
+	std::memcpy(&version, header + 4, sizeof(version));
+	if (version != HASHLOG_VERSION)
+		return (false);
+	hashes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	hashes.resize(hashes.size() - hashes.size() % sizeof(uint64_t));
+	return (true);
+}
+
+/**
+ * Compare two logs and print the first differing frame
+ *
+ * @return 0 if identical, 1 if they differ, 2 if a log can't be read
+ */
+int Gbmu::HashLog::compare (std::string const& pathA, std::string const& pathB)
+{
+	std::string		a, b;
+	size_t			frames;
+	size_t			i;
+	uint64_t		ha, hb;
+
+	if (load(pathA, a) == false || load(pathB, b) == false)
+	{
+		std::cerr << "Invalid hash log" << std::endl;
+		return (2);
+	}
+	frames = std::min(a.size(), b.size()) / sizeof(uint64_t);
+	for (i = 0; i < frames; i++)					// compare 8 bytes at a time
+	{
+		if (std::memcmp(a.data() + i * 8, b.data() + i * 8, 8))
+			break ;
+	}
+	if (i == frames && a.size() == b.size())
+	{
+		std::cout << "identical: " << frames << " frames" << std::endl;
+		return (0);
+	}
+	if (i == frames)
+	{
+		std::cout << "first difference at frame " << (i + 1) << ": "
+			<< (a.size() < b.size() ? pathA : pathB) << " ends" << std::endl;
+		return (1);
+	}
+	std::memcpy(&ha, a.data() + i * 8, 8);
+	std::memcpy(&hb, b.data() + i * 8, 8);
+	std::cout << "first difference at frame " << (i + 1) << ": " << std::hex
+		<< ha << " != " << hb << std::dec << std::endl;
+	return (1);
+}
@@ -53,9 +53,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		12,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		pc;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		pc;
 
 			pc = regs->getPC();
 			regs->setB(mem->getByteAt(pc + 2));
@@ -68,8 +68,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt(regs->getBC(), regs->getA());
 		}
@@ -80,7 +80,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setBC(regs->getBC() + 1);			// increment BC
 		}
@@ -91,8 +91,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		b;
+			Registers	*regs = cpu->regs();
+			uint8_t		b;
 
 			b = regs->getB();
 			regs->setFz(((b + 1) & 0xff) == 0);		// set zero (Z) flag if b == 0 after INC
@@ -107,8 +107,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		b;
+			Registers	*regs = cpu->regs();
+			uint8_t		b;
 
 			b = regs->getB();
 			regs->setFz(((b - 1) & 0xff) == 0);		// set zero (Z) flag if b == 0 after DEC
@@ -123,8 +123,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setB(mem->getByteAt(regs->getPC() + 1));
 		}
@@ -135,8 +135,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		a;
+			Registers	*regs = cpu->regs();
+			uint8_t		a;
 
 			a = regs->getA();
 			regs->setFz(false);
@@ -152,9 +152,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		20,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t			sp, pc;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t			sp, pc;
 
 			sp = regs->getSP();
 			pc = regs->getPC();
@@ -168,8 +168,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint16_t		hl, bc;
+			Registers	*regs = cpu->regs();
+			uint16_t		hl, bc;
 
 			hl = regs->getHL();
 			bc = regs->getBC();
@@ -185,8 +185,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setA(mem->getByteAt(regs->getBC()));
 		}
@@ -197,7 +197,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setBC(regs->getBC() - 1);
 		}
@@ -208,8 +208,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		c;
+			Registers	*regs = cpu->regs();
+			uint8_t		c;
 
 			c = regs->getC();
 			regs->setFz(((c + 1) & 0xff) == 0);
@@ -224,8 +224,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		c;
+			Registers	*regs = cpu->regs();
+			uint8_t		c;
 
 			c = regs->getC();
 			regs->setFz(((c - 1) & 0xff) == 0);
@@ -240,8 +240,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setC(mem->getByteAt(regs->getPC() + 1));
 		}
@@ -252,8 +252,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		a;
+			Registers	*regs = cpu->regs();
+			uint8_t		a;
 
 			a = regs->getA();
 			regs->setFz(false);
@@ -284,9 +284,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		12,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		pc;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		pc;
 
 			pc = regs->getPC();
 			regs->setD(mem->getByteAt(pc + 2));
@@ -299,8 +299,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt(regs->getDE(), regs->getA());
 		}
@@ -311,7 +311,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setDE(regs->getDE() + 1);
 		}
@@ -322,8 +322,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		d;
+			Registers	*regs = cpu->regs();
+			uint8_t		d;
 
 			d = regs->getD();
 			regs->setFz(((d + 1) & 0xff) == 0);
@@ -338,8 +338,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		d;
+			Registers	*regs = cpu->regs();
+			uint8_t		d;
 
 			d = regs->getD();
 			regs->setFz(((d - 1) & 0xff) == 0);
@@ -354,8 +354,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setD(mem->getByteAt(regs->getPC() + 1));
 		}
@@ -366,7 +366,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t				a;
 
 			a = regs->getA();
@@ -383,8 +383,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		12,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setPC(regs->getPC() + static_cast<int8_t>(mem->getByteAt(regs->getPC() + 1)));
 		}
@@ -395,7 +395,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint16_t			hl, de;
 
 			hl = regs->getHL();
@@ -412,8 +412,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setA(mem->getByteAt(regs->getDE()));
 		}
@@ -424,7 +424,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setDE(regs->getDE() - 1);
 		}
@@ -435,7 +435,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t				e;
 
 			e = regs->getE();
@@ -451,7 +451,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t				e;
 
 			e = regs->getE();
@@ -467,8 +467,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setE(mem->getByteAt(regs->getPC() + 1));
 		}
@@ -479,7 +479,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t				a;
 
 			a = regs->getA();
@@ -496,8 +496,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8, // 12 if jump is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			if (!regs->getFz())
 				regs->setPC(regs->getPC() + static_cast<int8_t>(mem->getByteAt(regs->getPC() + 1)));
@@ -509,9 +509,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		12,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		pc;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		pc;
 
 			pc = regs->getPC();
 			regs->setH(mem->getByteAt(pc + 2));
@@ -524,9 +524,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, regs->getA());
@@ -539,7 +539,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setHL(regs->getHL() + 1);
 		}
@@ -550,8 +550,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		h;
+			Registers	*regs = cpu->regs();
+			uint8_t		h;
 
 			h = regs->getH();
 			regs->setFz(((h + 1) & 0xff) == 0);
@@ -567,8 +567,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		h;
+			Registers	*regs = cpu->regs();
+			uint8_t		h;
 
 			h = regs->getH();
 			regs->setFz(((h - 1) & 0xff) == 0);
@@ -584,8 +584,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setH(mem->getByteAt(regs->getPC() + 1));
 		}
@@ -620,8 +620,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		a, hi, lo;
+			Registers	*regs = cpu->regs();
+			uint8_t		a, hi, lo;
 
 			a = regs->getA();
 			hi = a & 0xF0;
@@ -683,8 +683,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8, // 12 if jump is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			if (regs->getFz()) {
 				regs->setPC(static_cast<int8_t>(mem->getByteAt(regs->getPC() + 1)));
@@ -698,8 +698,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			regs->setHL(hl + hl);
@@ -714,9 +714,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Memory		*mem = cpu->memory();
-			static Registers	*regs = cpu->regs();
-			static uint16_t		hl;
+			Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			regs->setA(mem->getByteAt(hl));
@@ -729,7 +729,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setHL(regs->getHL() - 1);
 		}
@@ -740,8 +740,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		l;
+			Registers	*regs = cpu->regs();
+			uint8_t		l;
 
 			l = regs->getL();
 			regs->setFz(((l + 1) & 0xff) == 0);
@@ -756,8 +756,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		l;
+			Registers	*regs = cpu->regs();
+			uint8_t		l;
 
 			l = regs->getL();
 			regs->setFz(((l - 1) & 0xff) == 0);
@@ -772,8 +772,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setL(mem->getByteAt(regs->getPC() + 1));
 		}
@@ -784,7 +784,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(~regs->getA());
 			regs->setFn(true);
@@ -797,8 +797,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8, // 12 if jump is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			if (!regs->getFc()) {
 				regs->setPC(static_cast<int8_t>(mem->getByteAt(regs->getPC() + 1)));
@@ -812,9 +812,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		12,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		pc;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		pc;
 
 			pc = regs->getPC();
 			regs->setSP(mem->getWordAt(pc + 1));
@@ -826,9 +826,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, regs->getA());
@@ -841,7 +841,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setSP(regs->getSP() + 1);
 		}
@@ -852,9 +852,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		12,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		value, hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		value, hl;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -870,9 +870,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		12,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		value, hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		value, hl;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -888,8 +888,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		12,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt(regs->getHL(), mem->getByteAt(regs->getPC() + 1));
 		}
@@ -900,7 +900,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setFn(false);
 			regs->setFh(false);
@@ -913,8 +913,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8, // 12 if jump is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			if (regs->getFc()) {
 				regs->setPC(static_cast<int8_t>(mem->getByteAt(regs->getPC() + 1)));
@@ -927,8 +927,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint16_t		hl, sp;
+			Registers	*regs = cpu->regs();
+			uint16_t		hl, sp;
 
 			hl = regs->getHL();
 			sp = regs->getSP();
@@ -944,9 +944,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			regs->setA(mem->getByteAt(hl));
@@ -959,7 +959,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setSP(regs->getSP() - 1);
 		}
@@ -970,8 +970,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		a;
+			Registers	*regs = cpu->regs();
+			uint8_t		a;
 
 			a = regs->getA();
 			regs->setFz(((a + 1) & 0xff) == 0);
@@ -986,8 +986,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		a;
+			Registers	*regs = cpu->regs();
+			uint8_t		a;
 
 			a = regs->getA();
 			regs->setFz(((a - 1) & 0xff) == 0);
@@ -1002,8 +1002,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setA(mem->getByteAt(regs->getPC() + 1));
 		}
@@ -1014,7 +1014,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setFn(false);
 			regs->setFh(false);
@@ -1027,7 +1027,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB());
 		}
@@ -1038,7 +1038,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getC());
 		}
@@ -1049,7 +1049,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getD());
 		}
@@ -1060,7 +1060,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getE());
 		}
@@ -1071,7 +1071,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getH());
 		}
@@ -1082,7 +1082,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getL());
 		}
@@ -1093,8 +1093,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setB(mem->getByteAt(regs->getHL()));
 		}
@@ -1105,7 +1105,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getA());
 		}
@@ -1116,7 +1116,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getB());
 		}
@@ -1127,7 +1127,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC());
 		}
@@ -1138,7 +1138,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getD());
 		}
@@ -1149,7 +1149,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getE());
 		}
@@ -1160,7 +1160,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getH());
 		}
@@ -1171,7 +1171,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getL());
 		}
@@ -1182,8 +1182,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setC(mem->getByteAt(regs->getHL()));
 		}
@@ -1194,7 +1194,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getA());
 		}
@@ -1205,7 +1205,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getB());
 		}
@@ -1216,7 +1216,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getC());
 		}
@@ -1227,7 +1227,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD());
 		}
@@ -1238,7 +1238,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getE());
 		}
@@ -1249,7 +1249,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getH());
 		}
@@ -1260,7 +1260,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getL());
 		}
@@ -1271,8 +1271,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setD(mem->getByteAt(regs->getHL()));
 		}
@@ -1283,7 +1283,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getA());
 		}
@@ -1294,7 +1294,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getB());
 		}
@@ -1305,7 +1305,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getC());
 		}
@@ -1316,7 +1316,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getD());
 		}
@@ -1327,7 +1327,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE());
 		}
@@ -1338,7 +1338,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getH());
 		}
@@ -1349,7 +1349,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getL());
 		}
@@ -1360,8 +1360,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setE(mem->getByteAt(regs->getHL()));
 		}
@@ -1372,7 +1372,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getA());
 		}
@@ -1383,7 +1383,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getB());
 		}
@@ -1394,7 +1394,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getC());
 		}
@@ -1405,7 +1405,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getD());
 		}
@@ -1416,7 +1416,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getE());
 		}
@@ -1427,7 +1427,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH());
 		}
@@ -1438,7 +1438,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getL());
 		}
@@ -1449,8 +1449,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setH(mem->getByteAt(regs->getHL()));
 		}
@@ -1461,7 +1461,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getA());
 		}
@@ -1472,7 +1472,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getB());
 		}
@@ -1483,7 +1483,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getC());
 		}
@@ -1494,7 +1494,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getD());
 		}
@@ -1505,7 +1505,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getE());
 		}
@@ -1516,7 +1516,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getH());
 		}
@@ -1527,7 +1527,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL());
 		}
@@ -1538,8 +1538,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setL(mem->getByteAt(regs->getHL()));
 		}
@@ -1550,7 +1550,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getA());
 		}
@@ -1561,8 +1561,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt(regs->getHL(), regs->getB());
 		}
@@ -1573,8 +1573,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt(regs->getHL(), regs->getC());
 		}
@@ -1585,8 +1585,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt(regs->getHL(), regs->getD());
 		}
@@ -1597,8 +1597,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt(regs->getHL(), regs->getE());
 		}
@@ -1609,8 +1609,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt(regs->getHL(), regs->getH());
 		}
@@ -1621,8 +1621,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt(regs->getHL(), regs->getL());
 		}
@@ -1645,8 +1645,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt(regs->getHL(), regs->getA());
 		}
@@ -1657,7 +1657,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getB());
 		}
@@ -1668,7 +1668,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getC());
 		}
@@ -1679,7 +1679,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getD());
 		}
@@ -1690,7 +1690,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getE());
 		}
@@ -1701,7 +1701,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getH());
 		}
@@ -1712,7 +1712,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getL());
 		}
@@ -1723,8 +1723,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setA(mem->getByteAt(regs->getHL()));
 		}
@@ -1735,7 +1735,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA());
 		}
@@ -1746,9 +1746,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static uint8_t		a;
-			static uint8_t		b;
+			Registers	*regs = cpu->regs();
+			uint8_t		a;
+			uint8_t		b;
 
 			a = regs->getA();
 			b = regs->getB();
@@ -1763,7 +1763,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		c;
 
 			c = regs->getC();
@@ -1776,7 +1776,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		d;
 
 			d = regs->getD();
@@ -1789,7 +1789,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		e;
 
 			e = regs->getE();
@@ -1802,7 +1802,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		h;
 
 			h = regs->getH();
@@ -1815,7 +1815,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		l;
 
 			l = regs->getL();
@@ -1828,8 +1828,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			uint8_t		hl;
 
 			hl = mem->getByteAt(regs->getHL());
@@ -1842,7 +1842,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		a;
 
 			a = regs->getA();
@@ -1855,7 +1855,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		b;
 
 			b = regs->getB();
@@ -1868,7 +1868,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		c;
 
 			c = regs->getC();
@@ -1881,7 +1881,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		d;
 
 			d = regs->getD();
@@ -1894,7 +1894,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		e;
 
 			e = regs->getE();
@@ -1907,7 +1907,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		h;
 
 			h = regs->getH();
@@ -1920,7 +1920,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		l;
 
 			l = regs->getL();
@@ -1933,8 +1933,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			uint8_t		hl;
 
 			hl = mem->getByteAt(regs->getHL());
@@ -1947,7 +1947,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		a;
 
 			a = regs->getA();
@@ -1960,7 +1960,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		b;
 
 			b = regs->getB();
@@ -1973,7 +1973,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		c;
 
 			c = regs->getC();
@@ -1986,7 +1986,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		d;
 
 			d = regs->getD();
@@ -1999,7 +1999,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		e;
 
 			e = regs->getE();
@@ -2012,7 +2012,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		h;
 
 			h = regs->getH();
@@ -2025,7 +2025,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		l;
 
 			l = regs->getL();
@@ -2038,8 +2038,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			uint8_t		hl;
 
 			hl = mem->getByteAt(regs->getHL());
@@ -2052,7 +2052,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		a;
 
 			a = regs->getA();
@@ -2065,7 +2065,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		b;
 
 			b = regs->getB();
@@ -2078,7 +2078,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		c;
 
 			c = regs->getC();
@@ -2091,7 +2091,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		d;
 
 			d = regs->getD();
@@ -2104,7 +2104,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		e;
 
 			e = regs->getE();
@@ -2117,7 +2117,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		h;
 
 			h = regs->getH();
@@ -2130,7 +2130,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		l;
 
 			l = regs->getL();
@@ -2143,8 +2143,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			uint8_t		hl;
 
 			hl = mem->getByteAt(regs->getHL());
@@ -2157,7 +2157,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			uint8_t		a;
 
 			a = regs->getA();
@@ -2170,7 +2170,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			AND(regs->getB(), cpu);
 		}
 	};
@@ -2180,7 +2180,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			AND(regs->getC(), cpu);
 		}
 	};
@@ -2190,7 +2190,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			AND(regs->getD(), cpu);
 		}
 	};
@@ -2200,7 +2200,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			AND(regs->getE(), cpu);
 		}
 	};
@@ -2210,7 +2210,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			AND(regs->getH(), cpu);
 		}
 	};
@@ -2220,7 +2220,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			AND(regs->getL(), cpu);
 		}
 	};
@@ -2230,8 +2230,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers			*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			AND(mem->getByteAt(regs->getHL()), cpu);
 		}
 	};
@@ -2241,7 +2241,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			AND(regs->getA(), cpu);
 		}
 	};
@@ -2251,7 +2251,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			XOR(regs->getB(), cpu);
 		}
 	};
@@ -2261,7 +2261,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			XOR(regs->getC(), cpu);
 		}
 	};
@@ -2271,7 +2271,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			XOR(regs->getD(), cpu);
 		}
 	};
@@ -2281,7 +2281,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			XOR(regs->getE(), cpu);
 		}
 	};
@@ -2291,7 +2291,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			XOR(regs->getH(), cpu);
 		}
 	};
@@ -2301,7 +2301,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			XOR(regs->getL(), cpu);
 		}
 	};
@@ -2311,8 +2311,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers			*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			XOR(mem->getByteAt(regs->getHL()), cpu);
 		}
 	};
@@ -2322,7 +2322,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			XOR(regs->getA(), cpu);
 		}
 	};
@@ -2332,7 +2332,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			OR(regs->getB(), cpu);
 		}
 	};
@@ -2342,7 +2342,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			OR(regs->getC(), cpu);
 		}
 	};
@@ -2352,7 +2352,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			OR(regs->getD(), cpu);
 		}
 	};
@@ -2362,7 +2362,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			OR(regs->getE(), cpu);
 		}
 	};
@@ -2372,7 +2372,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			OR(regs->getH(), cpu);
 		}
 	};
@@ -2382,7 +2382,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers			*regs = cpu->regs();
+			Registers			*regs = cpu->regs();
 			OR(regs->getH(), cpu);
 		}
 	};
@@ -2392,8 +2392,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			OR(mem->getByteAt(regs->getHL()), cpu);
 		}
 	};
@@ -2403,7 +2403,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			OR(regs->getA(), cpu);
 		}
 	};
@@ -2413,7 +2413,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			CP(regs->getB(), cpu);
 		}
 	};
@@ -2423,7 +2423,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			CP(regs->getC(), cpu);
 		}
 	};
@@ -2433,7 +2433,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			CP(regs->getD(), cpu);
 		}
 	};
@@ -2443,7 +2443,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			CP(regs->getE(), cpu);
 		}
 	};
@@ -2453,7 +2453,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			CP(regs->getH(), cpu);
 		}
 	};
@@ -2463,7 +2463,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			CP(regs->getL(), cpu);
 		}
 	};
@@ -2473,8 +2473,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			CP(mem->getByteAt(regs->getB()), cpu);
 		}
 	};
@@ -2484,7 +2484,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			CP(regs->getA(), cpu);
 		}
 	};
@@ -2494,7 +2494,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8, // 20 if action is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			if (RET(!regs->getFz(), cpu)){
 				//cycle += 12
 			}
@@ -2515,7 +2515,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		12, // 16 if jump is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			if (JP(!regs->getFz(), cpu)){
 				//cycle += 4
 			}
@@ -2536,7 +2536,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		12, // 24 if action is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			if (CALL(!regs->getFz(), cpu))
 			{
 				//cycle += 12
@@ -2549,7 +2549,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		16,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			PUSH(regs->getBC(), cpu);
 		}
 	};
@@ -2559,8 +2559,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			ADDA(mem->getByteAt(regs->getPC() + 1), cpu);
 		}
@@ -2580,7 +2580,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8, // 20 if action is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			if (RET(regs->getFz(), cpu)){
 				//cycle += 12
 			}
@@ -2601,7 +2601,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		12, // 16 if jump is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			if (JP(regs->getFz(), cpu)){
 				//cycle += 4
 			}
@@ -2622,7 +2622,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		12, // 24 if action taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			if (CALL(regs->getFz(), cpu))
 			{
 				//cycle += 12
@@ -2644,8 +2644,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			ADCA(mem->getByteAt(regs->getPC() + 1), cpu);
 		}
@@ -2665,7 +2665,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8, // 20 if action is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			if (RET(!regs->getFc(), cpu)){
 				//cycle += 12
 			}
@@ -2686,7 +2686,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		12, // 16 is jump is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			if (JP(!regs->getFc(), cpu)){
 				//cycle += 4
 			}
@@ -2707,7 +2707,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		12, // 24 if action is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			if (CALL(!regs->getFc(), cpu)){
 				//cycle += 12
 			}
@@ -2719,7 +2719,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		16,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			PUSH(regs->getDE(), cpu);
 		}
 	};
@@ -2729,8 +2729,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			SUBA(mem->getByteAt(regs->getPC() + 1), cpu);
 		}
@@ -2750,7 +2750,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8, // 20 if action is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			if (RET(regs->getFc(), cpu)){
 				//cycle += 12
 			}
@@ -2762,7 +2762,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		16,
 		[](Cpu *cpu) {
-			(void)cpu;
+			RET(true, cpu);
+			cpu->regs()->setPC(cpu->regs()->getPC() - 1);	// back to the pushed address once size is added
+			cpu->interrupts()->enableNow();
 		}
 	};
 
@@ -2771,7 +2773,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		12, // 16 if jump is taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			if (JP(regs->getFc(), cpu)){
 				//cycle += 4
 			}
@@ -2792,7 +2794,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		12, // 24 if actio nis taken
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			if (CALL(regs->getFc(), cpu)){
 				//cycle += 12
 			}
@@ -2813,8 +2815,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			SBCA(mem->getByteAt(regs->getPC() + 1), cpu);
 		}
@@ -2834,8 +2836,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		12,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt(0xFF00 + mem->getByteAt(regs->getPC() + 1), regs->getA());
 		}
@@ -2855,8 +2857,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt(regs->getC(), regs->getA());
 		}
@@ -2885,7 +2887,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		16,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			PUSH(regs->getHL(), cpu);
 		}
 	};
@@ -2895,8 +2897,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			AND(mem->getByteAt(regs->getPC() + 1), cpu);
 		}
 	};
@@ -2915,8 +2917,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		16,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			uint8_t		a, value;
 
 			value = mem->getByteAt(regs->getPC() + 1);
@@ -2934,7 +2936,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			regs->setPC(regs->getHL());
 			regs->setPC(regs->getPC() - 1);
 		}
@@ -2945,8 +2947,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		16,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			mem->setByteAt((mem->getByteAt(regs->getPC() + 1))  + (mem->getByteAt(regs->getPC() + 2) << 8), regs->getA());
 		}
@@ -2984,8 +2986,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			XOR(mem->getByteAt(regs->getPC() + 1), cpu);
 		}
 	};
@@ -3004,8 +3006,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		12,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			regs->setA(mem->getByteAt(0xFF00 + mem->getByteAt(regs->getPC() + 1)));
 		}
 	};
@@ -3024,8 +3026,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setA(mem->getByteAt(regs->getC()));
 		}
@@ -3036,7 +3038,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			(void)cpu;
+			cpu->interrupts()->disable();
 		}
 	};
 
@@ -3054,7 +3056,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		16,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 			PUSH(regs->getAF(), cpu);
 		}
 	};
@@ -3064,8 +3066,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			OR(mem->getByteAt(regs->getPC() + 1), cpu);
 		}
 	};
@@ -3084,8 +3086,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		12,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setHL(regs->getSP() + mem->getByteAt(regs->getPC() + 1));
 			regs->setFh(FLAG_H16_ADD(regs->getSP(), mem->getByteAt(regs->getPC() + 1)));
@@ -3098,7 +3100,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setSP(regs->getHL());
 		}
@@ -3109,8 +3111,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		3,
 		16,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			regs->setA((mem->getByteAt(regs->getPC() + 1))  + (mem->getByteAt(regs->getPC() + 2) << 8));
 		}
@@ -3121,7 +3123,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		1,
 		4,
 		[](Cpu *cpu) {
-			(void)cpu;
+			cpu->interrupts()->enable();
 		}
 	};
 
@@ -3148,8 +3150,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 			CP(mem->getByteAt(regs->getPC() + 1), cpu);
 		}
 	};
@@ -3168,7 +3170,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(CB_RLC(regs->getB(), cpu));
 		}
@@ -3179,7 +3181,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(CB_RLC(regs->getC(), cpu));
 		}
@@ -3190,7 +3192,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(CB_RLC(regs->getD(), cpu));
 		}
@@ -3201,7 +3203,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(CB_RLC(regs->getE(), cpu));
 		}
@@ -3212,7 +3214,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(CB_RLC(regs->getH(), cpu));
 		}
@@ -3223,7 +3225,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(CB_RLC(regs->getL(), cpu));
 		}
@@ -3234,10 +3236,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -3250,7 +3252,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(CB_RLC(regs->getA(), cpu));
 		}
@@ -3261,7 +3263,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(CB_RRC(regs->getB(), cpu));
 		}
@@ -3272,7 +3274,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(CB_RRC(regs->getC(), cpu));
 		}
@@ -3283,7 +3285,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(CB_RRC(regs->getD(), cpu));
 		}
@@ -3294,7 +3296,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(CB_RRC(regs->getE(), cpu));
 		}
@@ -3305,7 +3307,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(CB_RRC(regs->getH(), cpu));
 		}
@@ -3316,7 +3318,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(CB_RRC(regs->getL(), cpu));
 		}
@@ -3327,10 +3329,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -3343,7 +3345,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(CB_RRC(regs->getA(), cpu));
 		}
@@ -3354,7 +3356,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(CB_RL(regs->getB(), cpu));
 		}
@@ -3365,7 +3367,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(CB_RL(regs->getC(), cpu));
 		}
@@ -3376,7 +3378,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(CB_RL(regs->getD(), cpu));
 		}
@@ -3387,7 +3389,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(CB_RL(regs->getE(), cpu));
 		}
@@ -3398,7 +3400,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(CB_RL(regs->getH(), cpu));
 		}
@@ -3409,7 +3411,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(CB_RL(regs->getL(), cpu));
 		}
@@ -3420,10 +3422,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -3436,7 +3438,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(CB_RL(regs->getA(), cpu));
 		}
@@ -3447,7 +3449,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(CB_RR(regs->getB(), cpu));
 		}
@@ -3458,7 +3460,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(CB_RR(regs->getC(), cpu));
 		}
@@ -3469,7 +3471,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(CB_RR(regs->getD(), cpu));
 		}
@@ -3480,7 +3482,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(CB_RR(regs->getE(), cpu));
 		}
@@ -3491,7 +3493,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(CB_RR(regs->getH(), cpu));
 		}
@@ -3502,7 +3504,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(CB_RR(regs->getL(), cpu));
 		}
@@ -3513,10 +3515,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -3529,7 +3531,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(CB_RR(regs->getA(), cpu));
 		}
@@ -3540,7 +3542,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(CB_SLA(regs->getB(), cpu));
 		}
@@ -3551,7 +3553,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(CB_SLA(regs->getC(), cpu));
 		}
@@ -3562,7 +3564,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(CB_SLA(regs->getD(), cpu));
 		}
@@ -3573,7 +3575,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(CB_SLA(regs->getE(), cpu));
 		}
@@ -3584,7 +3586,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(CB_SLA(regs->getH(), cpu));
 		}
@@ -3595,7 +3597,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(CB_SLA(regs->getL(), cpu));
 		}
@@ -3606,10 +3608,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -3622,7 +3624,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(CB_SLA(regs->getA(), cpu));
 		}
@@ -3633,7 +3635,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(CB_SRA(regs->getB(), cpu));
 		}
@@ -3644,7 +3646,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(CB_SRA(regs->getC(), cpu));
 		}
@@ -3655,7 +3657,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(CB_SRA(regs->getD(), cpu));
 		}
@@ -3666,7 +3668,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(CB_SRA(regs->getE(), cpu));
 		}
@@ -3677,7 +3679,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(CB_SRA(regs->getH(), cpu));
 		}
@@ -3688,7 +3690,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(CB_SRA(regs->getL(), cpu));
 		}
@@ -3699,10 +3701,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -3715,7 +3717,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(CB_SRA(regs->getA(), cpu));
 		}
@@ -3726,7 +3728,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(CB_SWAP(regs->getB(), cpu));
 		}
@@ -3737,7 +3739,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(CB_SWAP(regs->getC(), cpu));
 		}
@@ -3748,7 +3750,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(CB_SWAP(regs->getD(), cpu));
 		}
@@ -3759,7 +3761,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(CB_SWAP(regs->getE(), cpu));
 		}
@@ -3770,7 +3772,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(CB_SWAP(regs->getH(), cpu));
 		}
@@ -3781,7 +3783,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(CB_SWAP(regs->getL(), cpu));
 		}
@@ -3792,10 +3794,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -3808,7 +3810,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(CB_SWAP(regs->getA(), cpu));
 		}
@@ -3819,7 +3821,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(CB_SRL(regs->getB(), cpu));
 		}
@@ -3830,7 +3832,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(CB_SRL(regs->getC(), cpu));
 		}
@@ -3841,7 +3843,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(CB_SRL(regs->getD(), cpu));
 		}
@@ -3852,7 +3854,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(CB_SRL(regs->getE(), cpu));
 		}
@@ -3863,7 +3865,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(CB_SRL(regs->getH(), cpu));
 		}
@@ -3874,7 +3876,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(CB_SRL(regs->getL(), cpu));
 		}
@@ -3885,10 +3887,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -3901,7 +3903,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(CB_SRL(regs->getA(), cpu));
 		}
@@ -3912,7 +3914,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(0, regs->getB(), cpu);
 		}
@@ -3923,7 +3925,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(0, regs->getC(), cpu);
 		}
@@ -3934,7 +3936,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(0, regs->getD(), cpu);
 		}
@@ -3945,7 +3947,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(0, regs->getE(), cpu);
 		}
@@ -3956,7 +3958,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(0, regs->getH(), cpu);
 		}
@@ -3967,7 +3969,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(0, regs->getL(), cpu);
 		}
@@ -3978,8 +3980,8 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
 
 			CB_BIT(0, mem->getByteAt(regs->getHL()), cpu);
 		}
@@ -3990,7 +3992,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(0, regs->getA(), cpu);
 		}
@@ -4001,7 +4003,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(1, regs->getB(), cpu);
 		}
@@ -4012,7 +4014,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(1, regs->getC(), cpu);
 		}
@@ -4023,7 +4025,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(1, regs->getD(), cpu);
 		}
@@ -4034,7 +4036,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(1, regs->getE(), cpu);
 		}
@@ -4045,7 +4047,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(1, regs->getH(), cpu);
 		}
@@ -4056,7 +4058,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(1, regs->getL(), cpu);
 		}
@@ -4067,10 +4069,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -4083,7 +4085,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(1, regs->getA(), cpu);
 		}
@@ -4094,7 +4096,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(2, regs->getB(), cpu);
 		}
@@ -4105,7 +4107,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(2, regs->getC(), cpu);
 		}
@@ -4116,7 +4118,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(2, regs->getD(), cpu);
 		}
@@ -4127,7 +4129,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(2, regs->getE(), cpu);
 		}
@@ -4138,7 +4140,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(2, regs->getH(), cpu);
 		}
@@ -4149,7 +4151,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(2, regs->getL(), cpu);
 		}
@@ -4160,10 +4162,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -4176,7 +4178,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(2, regs->getA(), cpu);
 		}
@@ -4187,7 +4189,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(3, regs->getB(), cpu);
 		}
@@ -4198,7 +4200,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(3, regs->getC(), cpu);
 		}
@@ -4209,7 +4211,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(3, regs->getD(), cpu);
 		}
@@ -4220,7 +4222,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(3, regs->getE(), cpu);
 		}
@@ -4231,7 +4233,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(3, regs->getH(), cpu);
 		}
@@ -4242,7 +4244,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(3, regs->getL(), cpu);
 		}
@@ -4253,10 +4255,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -4269,7 +4271,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(3, regs->getA(), cpu);
 		}
@@ -4280,7 +4282,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(4, regs->getB(), cpu);
 		}
@@ -4291,7 +4293,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(4, regs->getC(), cpu);
 		}
@@ -4302,7 +4304,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(4, regs->getD(), cpu);
 		}
@@ -4313,7 +4315,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(4, regs->getE(), cpu);
 		}
@@ -4324,7 +4326,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(4, regs->getH(), cpu);
 		}
@@ -4335,7 +4337,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(4, regs->getL(), cpu);
 		}
@@ -4346,10 +4348,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -4363,7 +4365,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		8,
 		[](Cpu *cpu) {
 			(void)cpu;
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(4, regs->getA(), cpu);
 		}
@@ -4374,7 +4376,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(5, regs->getB(), cpu);
 		}
@@ -4385,7 +4387,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(5, regs->getC(), cpu);
 		}
@@ -4396,7 +4398,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(5, regs->getD(), cpu);
 		}
@@ -4407,7 +4409,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(5, regs->getE(), cpu);
 		}
@@ -4418,7 +4420,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(5, regs->getH(), cpu);
 		}
@@ -4429,7 +4431,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(5, regs->getL(), cpu);
 		}
@@ -4440,10 +4442,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -4456,7 +4458,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(5, regs->getA(), cpu);
 		}
@@ -4467,7 +4469,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(6, regs->getB(), cpu);
 		}
@@ -4478,7 +4480,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(6, regs->getC(), cpu);
 		}
@@ -4489,7 +4491,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(6, regs->getD(), cpu);
 		}
@@ -4500,7 +4502,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(6, regs->getE(), cpu);
 		}
@@ -4511,7 +4513,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(6, regs->getH(), cpu);
 		}
@@ -4522,7 +4524,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(6, regs->getL(), cpu);
 		}
@@ -4533,10 +4535,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -4549,7 +4551,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(6, regs->getA(), cpu);
 		}
@@ -4560,7 +4562,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(7, regs->getB(), cpu);
 		}
@@ -4571,7 +4573,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(7, regs->getC(), cpu);
 		}
@@ -4582,7 +4584,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(7, regs->getD(), cpu);
 		}
@@ -4593,7 +4595,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(7, regs->getE(), cpu);
 		}
@@ -4604,7 +4606,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(7, regs->getH(), cpu);
 		}
@@ -4615,7 +4617,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(7, regs->getL(), cpu);
 		}
@@ -4626,10 +4628,10 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
-			static uint8_t		value;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
+			uint8_t		value;
 
 			hl = regs->getHL();
 			value = mem->getByteAt(hl);
@@ -4642,7 +4644,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			CB_BIT(7, regs->getA(), cpu);
 		}
@@ -4653,7 +4655,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() & ~(1 << 0));
 		}
@@ -4664,7 +4666,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() & ~(1 << 0));
 		}
@@ -4675,7 +4677,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() & ~(1 << 0));
 		}
@@ -4686,7 +4688,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() & ~(1 << 0));
 		}
@@ -4697,7 +4699,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() & ~(1 << 0));
 		}
@@ -4708,7 +4710,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() & ~(1 << 0));
 		}
@@ -4719,9 +4721,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) & ~(1 << 0));
@@ -4733,7 +4735,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() & ~(1 << 0));
 		}
@@ -4744,7 +4746,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() & ~(1 << 1));
 		}
@@ -4755,7 +4757,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() & ~(1 << 1));
 		}
@@ -4766,7 +4768,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() & ~(1 << 1));
 		}
@@ -4777,7 +4779,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() & ~(1 << 1));
 		}
@@ -4788,7 +4790,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() & ~(1 << 1));
 		}
@@ -4799,7 +4801,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() & ~(1 << 1));
 		}
@@ -4810,9 +4812,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) & ~(1 << 1));
@@ -4824,7 +4826,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() & ~(1 << 1));
 		}
@@ -4835,7 +4837,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() & ~(1 << 2));
 		}
@@ -4846,7 +4848,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() & ~(1 << 2));
 		}
@@ -4857,7 +4859,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() & ~(1 << 2));
 		}
@@ -4868,7 +4870,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() & ~(1 << 2));
 		}
@@ -4879,7 +4881,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() & ~(1 << 2));
 		}
@@ -4890,7 +4892,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() & ~(1 << 2));
 		}
@@ -4901,9 +4903,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) & ~(1 << 2));
@@ -4915,7 +4917,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() & ~(1 << 2));
 		}
@@ -4926,7 +4928,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() & ~(1 << 3));
 		}
@@ -4937,7 +4939,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() & ~(1 << 3));
 		}
@@ -4948,7 +4950,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() & ~(1 << 3));
 		}
@@ -4959,7 +4961,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() & ~(1 << 3));
 		}
@@ -4970,7 +4972,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() & ~(1 << 3));
 		}
@@ -4981,7 +4983,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() & ~(1 << 3));
 		}
@@ -4992,9 +4994,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) & ~(1 << 3));
@@ -5006,7 +5008,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() & ~(1 << 3));
 		}
@@ -5017,7 +5019,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() & ~(1 << 4));
 		}
@@ -5028,7 +5030,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() & ~(1 << 4));
 		}
@@ -5039,7 +5041,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() & ~(1 << 4));
 		}
@@ -5050,7 +5052,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() & ~(1 << 4));
 		}
@@ -5061,7 +5063,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() & ~(1 << 4));
 		}
@@ -5072,7 +5074,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() & ~(1 << 4));
 		}
@@ -5083,9 +5085,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) & ~(1 << 4));
@@ -5097,7 +5099,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() & ~(1 << 4));
 		}
@@ -5108,7 +5110,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() & ~(1 << 5));
 		}
@@ -5119,7 +5121,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() & ~(1 << 5));
 		}
@@ -5130,7 +5132,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() & ~(1 << 5));
 		}
@@ -5141,7 +5143,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() & ~(1 << 5));
 		}
@@ -5152,7 +5154,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() & ~(1 << 5));
 		}
@@ -5163,7 +5165,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() & ~(1 << 5));
 		}
@@ -5174,9 +5176,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) & ~(1 << 5));
@@ -5188,7 +5190,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() & ~(1 << 5));
 		}
@@ -5199,7 +5201,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() & ~(1 << 6));
 		}
@@ -5210,7 +5212,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() & ~(1 << 6));
 		}
@@ -5221,7 +5223,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() & ~(1 << 6));
 		}
@@ -5232,7 +5234,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() & ~(1 << 6));
 		}
@@ -5243,7 +5245,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() & ~(1 << 6));
 		}
@@ -5254,7 +5256,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() & ~(1 << 6));
 		}
@@ -5265,9 +5267,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) & ~(1 << 6));
@@ -5279,7 +5281,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() & ~(1 << 6));
 		}
@@ -5290,7 +5292,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() & ~(1 << 7));
 		}
@@ -5301,7 +5303,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() & ~(1 << 7));
 		}
@@ -5312,7 +5314,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() & ~(1 << 7));
 		}
@@ -5323,7 +5325,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() & ~(1 << 7));
 		}
@@ -5334,7 +5336,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() & ~(1 << 7));
 		}
@@ -5345,7 +5347,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() & ~(1 << 7));
 		}
@@ -5356,9 +5358,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) & ~(1 << 7));
@@ -5370,7 +5372,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() & ~(1 << 7));
 		}
@@ -5382,7 +5384,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() | (1 << 0));
 		}
@@ -5393,7 +5395,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() | (1 << 0));
 		}
@@ -5404,7 +5406,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() | (1 << 0));
 		}
@@ -5415,7 +5417,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() | (1 << 0));
 		}
@@ -5426,7 +5428,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() | (1 << 0));
 		}
@@ -5437,7 +5439,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() | (1 << 0));
 		}
@@ -5448,9 +5450,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) | (1 << 0));
@@ -5462,7 +5464,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() | (1 << 0));
 		}
@@ -5473,7 +5475,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() | (1 << 1));
 		}
@@ -5484,7 +5486,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() | (1 << 1));
 		}
@@ -5495,7 +5497,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() | (1 << 1));
 		}
@@ -5506,7 +5508,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() | (1 << 1));
 		}
@@ -5517,7 +5519,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() | (1 << 1));
 		}
@@ -5528,7 +5530,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() | (1 << 1));
 		}
@@ -5539,9 +5541,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) | (1 << 1));
@@ -5553,7 +5555,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() | (1 << 1));
 		}
@@ -5564,7 +5566,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() | (1 << 2));
 		}
@@ -5575,7 +5577,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() | (1 << 2));
 		}
@@ -5586,7 +5588,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() | (1 << 2));
 		}
@@ -5597,7 +5599,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() | (1 << 2));
 		}
@@ -5608,7 +5610,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() | (1 << 2));
 		}
@@ -5619,7 +5621,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() | (1 << 2));
 		}
@@ -5630,9 +5632,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) | (1 << 2));
@@ -5644,7 +5646,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() | (1 << 2));
 		}
@@ -5655,7 +5657,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() | (1 << 3));
 		}
@@ -5666,7 +5668,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() | (1 << 3));
 		}
@@ -5677,7 +5679,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() | (1 << 3));
 		}
@@ -5688,7 +5690,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() | (1 << 3));
 		}
@@ -5699,7 +5701,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() | (1 << 3));
 		}
@@ -5710,7 +5712,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() | (1 << 3));
 		}
@@ -5721,9 +5723,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) | (1 << 3));
@@ -5735,7 +5737,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() | (1 << 3));
 		}
@@ -5746,7 +5748,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() | (1 << 4));
 		}
@@ -5757,7 +5759,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() | (1 << 4));
 		}
@@ -5768,7 +5770,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() | (1 << 4));
 		}
@@ -5779,7 +5781,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() | (1 << 4));
 		}
@@ -5790,7 +5792,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() | (1 << 4));
 		}
@@ -5801,7 +5803,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() | (1 << 4));
 		}
@@ -5812,9 +5814,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) | (1 << 4));
@@ -5826,7 +5828,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() | (1 << 4));
 		}
@@ -5837,7 +5839,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() | (1 << 5));
 		}
@@ -5848,7 +5850,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() | (1 << 5));
 		}
@@ -5859,7 +5861,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() | (1 << 5));
 		}
@@ -5870,7 +5872,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() | (1 << 5));
 		}
@@ -5881,7 +5883,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() | (1 << 5));
 		}
@@ -5892,7 +5894,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() | (1 << 5));
 		}
@@ -5903,9 +5905,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) | (1 << 5));
@@ -5917,7 +5919,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() | (1 << 5));
 		}
@@ -5928,7 +5930,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() | (1 << 6));
 		}
@@ -5939,7 +5941,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() | (1 << 6));
 		}
@@ -5950,7 +5952,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() | (1 << 6));
 		}
@@ -5961,7 +5963,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() | (1 << 6));
 		}
@@ -5972,7 +5974,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() | (1 << 6));
 		}
@@ -5983,7 +5985,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() | (1 << 6));
 		}
@@ -5994,9 +5996,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) | (1 << 6));
@@ -6008,7 +6010,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() | (1 << 6));
 		}
@@ -6019,7 +6021,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setB(regs->getB() | (1 << 7));
 		}
@@ -6030,7 +6032,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setC(regs->getC() | (1 << 7));
 		}
@@ -6041,7 +6043,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setD(regs->getD() | (1 << 7));
 		}
@@ -6052,7 +6054,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setE(regs->getE() | (1 << 7));
 		}
@@ -6063,7 +6065,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setH(regs->getH() | (1 << 7));
 		}
@@ -6074,7 +6076,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setL(regs->getL() | (1 << 7));
 		}
@@ -6085,9 +6087,9 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
-			static Memory		*mem = cpu->memory();
-			static uint16_t		hl;
+			Registers	*regs = cpu->regs();
+			Memory		*mem = cpu->memory();
+			uint16_t		hl;
 
 			hl = regs->getHL();
 			mem->setByteAt(hl, mem->getByteAt(hl) | (1 << 7));
@@ -6099,7 +6101,7 @@ Gbmu::Instructions::Instructions(Cpu *cpu) : _cpu(cpu) {
 		2,
 		8,
 		[](Cpu *cpu) {
-			static Registers	*regs = cpu->regs();
+			Registers	*regs = cpu->regs();
 
 			regs->setA(regs->getA() | (1 << 7));
 		}
@@ -6114,16 +6116,28 @@ Gbmu::Instructions::~Instructions(void) {}
 
 /**
  * Dispatcher function that calls the correct function based on the passed opcode
+ * 0xCB opcodes are dispatched to the _cbInstructions table with the next byte
  *
  * @param opcode - The instruction we want to execute
+ * @return The number of clock cycles of the instruction
  */
-void Gbmu::Instructions::execute(uint8_t opcode) {
-	static t_instruction	*instruction;
-	static Registers		*regs = _cpu->regs();
-
-	instruction = &_instructions[opcode];				// get correct t_instruction structure
+int Gbmu::Instructions::execute(uint8_t opcode) {
+	t_instruction	*instruction;
+	Registers		*regs = _cpu->regs();
+
+	if (opcode == 0xcb)
+		instruction = &_cbInstructions[_cpu->memory()->getByteAt(regs->getPC() + 1)];
+	else
+		instruction = &_instructions[opcode];			// get correct t_instruction structure
 	instruction->exec(_cpu);							// execute instruction
 	regs->setPC(regs->getPC() + instruction->size);		// add instruction size to current PC
+	return (instruction->cycles);
+}
+
+std::string const& Gbmu::Instructions::name(uint8_t opcode, uint8_t cb) const {
+	if (opcode == 0xcb)
+		return (_cbInstructions[cb].name);
+	return (_instructions[opcode].name);
 }
 
 /**
@@ -6132,7 +6146,7 @@ void Gbmu::Instructions::execute(uint8_t opcode) {
 
 void		Gbmu::Instructions::ADDA(uint8_t value, Cpu *cpu)
 {
-	static Registers	*regs = cpu->regs();
+	Registers	*regs = cpu->regs();
 	uint8_t		a;
 			
 	a = regs->getA();
@@ -6145,7 +6159,7 @@ void		Gbmu::Instructions::ADDA(uint8_t value, Cpu *cpu)
 
 void		Gbmu::Instructions::ADCA(uint8_t value, Cpu *cpu)
 {
-	static Registers	*regs = cpu->regs();
+	Registers	*regs = cpu->regs();
 	
 	value += regs->getFc();
 	ADDA(value, cpu);
@@ -6153,7 +6167,7 @@ void		Gbmu::Instructions::ADCA(uint8_t value, Cpu *cpu)
 
 void		Gbmu::Instructions::SUBA(uint8_t value, Cpu *cpu)
 {
-	static Registers	*regs = cpu->regs();
+	Registers	*regs = cpu->regs();
 	uint8_t		a;
 			
 	a = regs->getA();
@@ -6166,7 +6180,7 @@ void		Gbmu::Instructions::SUBA(uint8_t value, Cpu *cpu)
 
 void		Gbmu::Instructions::SBCA(uint8_t value, Cpu *cpu)
 {
-	static Registers	*regs = cpu->regs();
+	Registers	*regs = cpu->regs();
 	
 	value += regs->getFc();
 	SUBA(value, cpu);
@@ -6174,7 +6188,7 @@ void		Gbmu::Instructions::SBCA(uint8_t value, Cpu *cpu)
 
 void		Gbmu::Instructions::AND(uint8_t value, Cpu *cpu)
 {
-	static Registers	*regs = cpu->regs();
+	Registers	*regs = cpu->regs();
 
 	regs->setA(regs->getA() & value);
 	regs->setFz(regs->getA() ? 0 : 1); // set zero flags
@@ -6186,7 +6200,7 @@ void		Gbmu::Instructions::AND(uint8_t value, Cpu *cpu)
 
 void		Gbmu::Instructions::XOR(uint8_t value, Cpu *cpu)
 {
-	static Registers	*regs = cpu->regs();
+	Registers	*regs = cpu->regs();
 
 	regs->setA(regs->getA() ^ value);
 	regs->setFz(regs->getA() ? 0 : 1); // set zero flags
@@ -6198,7 +6212,7 @@ void		Gbmu::Instructions::XOR(uint8_t value, Cpu *cpu)
 
 void		Gbmu::Instructions::OR(uint8_t value, Cpu *cpu)
 {
-	static Registers	*regs = cpu->regs();
+	Registers	*regs = cpu->regs();
 
 	regs->setA(regs->getA() | value);
 	regs->setFz(regs->getA() ? 0 : 1); // set zero flags
@@ -6209,8 +6223,8 @@ void		Gbmu::Instructions::OR(uint8_t value, Cpu *cpu)
 
 void		Gbmu::Instructions::RST(uint8_t value, Cpu *cpu) //compare
 {
-	static Registers	*regs = cpu->regs();
-	static Memory		*mem = cpu->memory();
+	Registers	*regs = cpu->regs();
+	Memory		*mem = cpu->memory();
 
 	mem->setByteAt((regs->getSP() - 1), (regs->getPC() & 0xff00) >> 8);
 	mem->setByteAt((regs->getSP() - 2), (regs->getPC() & 0x00ff));
@@ -6218,7 +6232,7 @@ void		Gbmu::Instructions::RST(uint8_t value, Cpu *cpu) //compare
 	regs->setPC(value);
 }
 uint8_t		Gbmu::Instructions::CB_RLC(uint8_t value, Cpu *cpu) {
-	static Registers	*regs = cpu->regs();
+	Registers	*regs = cpu->regs();
 
 	regs->setFz((((value << 1) | (value >> 7)) & 0xff) == 0);
 	regs->setFn(false);
@@ -6228,7 +6242,7 @@ uint8_t		Gbmu::Instructions::CB_RLC(uint8_t value, Cpu *cpu) {
 }
 
 uint8_t		Gbmu::Instructions::CB_RRC(uint8_t value, Cpu *cpu) {
-	static Registers	*regs = cpu->regs();
+	Registers	*regs = cpu->regs();
 
 	regs->setFz((((value >> 1) | (value << 7)) & 0xff) == 0);
 	regs->setFn(false);
@@ -6238,8 +6252,8 @@ uint8_t		Gbmu::Instructions::CB_RRC(uint8_t value, Cpu *cpu) {
 }
 
 uint8_t		Gbmu::Instructions::CB_RL(uint8_t value, Cpu *cpu) {
-	static Registers	*regs = cpu->regs();
-	static uint8_t		retval;
+	Registers	*regs = cpu->regs();
+	uint8_t		retval;
 
 	retval = (value << 1) | regs->getFc();
 	regs->setFz((retval & 0xff) == 0);
@@ -6250,8 +6264,8 @@ uint8_t		Gbmu::Instructions::CB_RL(uint8_t value, Cpu *cpu) {
 }
 
 uint8_t		Gbmu::Instructions::CB_RR(uint8_t value, Cpu *cpu) {
-	static Registers	*regs = cpu->regs();
-	static uint8_t		retval;
+	Registers	*regs = cpu->regs();
+	uint8_t		retval;
 
 	retval = (value >> 1) | regs->getFc();
 	regs->setFz((retval & 0xff) == 0);
@@ -6261,7 +6275,7 @@ uint8_t		Gbmu::Instructions::CB_RR(uint8_t value, Cpu *cpu) {
 }
 
 uint8_t		Gbmu::Instructions::CB_SLA(uint8_t value, Cpu *cpu) {
-	static Registers	*regs = cpu->regs();
+	Registers	*regs = cpu->regs();
 
 	regs->setFz(((value << 1) & 0xff) == 0);
 	regs->setFn(false);
@@ -6271,8 +6285,8 @@ uint8_t		Gbmu::Instructions::CB_SLA(uint8_t value, Cpu *cpu) {
 }
 
 uint8_t		Gbmu::Instructions::CB_SRA(uint8_t value, Cpu *cpu) {
-	static Registers	*regs = cpu->regs();
-	static uint8_t		retval;
+	Registers	*regs = cpu->regs();
+	uint8_t		retval;
 
 	retval = (value >> 1) | (value & (1 << 7));
 	regs->setFz((retval & 0xff) == 0);
@@ -6283,8 +6297,8 @@ uint8_t		Gbmu::Instructions::CB_SRA(uint8_t value, Cpu *cpu) {
 }
 
 uint8_t		Gbmu::Instructions::CB_SWAP(uint8_t value, Cpu *cpu) {
-	static Registers	*regs = cpu->regs();
-	static uint8_t		retval;
+	Registers	*regs = cpu->regs();
+	uint8_t		retval;
 
 	retval = ((value & 0x0f) << 4) | ((value & 0xf0) >> 4);
 	regs->setFz((retval & 0xff) == 0);
@@ -6295,7 +6309,7 @@ uint8_t		Gbmu::Instructions::CB_SWAP(uint8_t value, Cpu *cpu) {
 }
 
 uint8_t		Gbmu::Instructions::CB_SRL(uint8_t value, Cpu *cpu) {
-	static Registers	*regs = cpu->regs();
+	Registers	*regs = cpu->regs();
 
 	regs->setFz(((value >> 1) & 0xff) == 0);
 	regs->setFn(false);
@@ -6305,7 +6319,7 @@ uint8_t		Gbmu::Instructions::CB_SRL(uint8_t value, Cpu *cpu) {
 }
 
 void		Gbmu::Instructions::CB_BIT(int pos, uint8_t value, Cpu *cpu) {
-	static Registers	*regs = cpu->regs();
+	Registers	*regs = cpu->regs();
 
 	regs->setFn(false);
 	regs->setFh(false);
@@ -6332,8 +6346,8 @@ void		Gbmu::Instructions::CP(uint8_t value, Cpu *cpu) //compare
 
 bool		Gbmu::Instructions::RET(bool flag, Cpu *cpu)
 {
-	static Registers	*regs = cpu->regs();
-	static Memory		*mem = cpu->memory();
+	Registers	*regs = cpu->regs();
+	Memory		*mem = cpu->memory();
 
 	if (flag){
 		regs->setPC( (mem->getByteAt(regs->getSP())) + (mem->getByteAt(regs->getSP() + 1) << 8));
@@ -6345,8 +6359,8 @@ bool		Gbmu::Instructions::RET(bool flag, Cpu *cpu)
 
 bool		Gbmu::Instructions::JP(bool flag, Cpu *cpu)
 {
-	static Registers	*regs = cpu->regs();
-	static Memory		*mem = cpu->memory();
+	Registers	*regs = cpu->regs();
+	Memory		*mem = cpu->memory();
 
 	if (flag){
 		regs->setPC((mem->getByteAt(regs->getPC() + 1)) + (mem->getByteAt(regs->getPC() + 2) << 8));
@@ -6358,8 +6372,8 @@ bool		Gbmu::Instructions::JP(bool flag, Cpu *cpu)
 
 bool		Gbmu::Instructions::CALL(bool flag, Cpu *cpu)
 {
-	static Registers	*regs = cpu->regs();
-	static Memory		*mem = cpu->memory();
+	Registers	*regs = cpu->regs();
+	Memory		*mem = cpu->memory();
 	if (flag)
 	{
 		mem->setByteAt(regs->getSP() - 1, regs->getPC() >> 8);
@@ -6373,8 +6387,8 @@ bool		Gbmu::Instructions::CALL(bool flag, Cpu *cpu)
 
 void		Gbmu::Instructions::PUSH(uint16_t value, Cpu *cpu)
 {
-	static Registers	*regs = cpu->regs();
-	static Memory		*mem = cpu->memory();
+	Registers	*regs = cpu->regs();
+	Memory		*mem = cpu->memory();
 
 	mem->setByteAt(regs->getSP() - 1, value >> 8);
 	mem->setByteAt(regs->getSP() - 2, value & 0xf);
@@ -0,0 +1,114 @@
+#include "../includes/Interrupts.class.hpp"
+#include <new>
+
+Gbmu::Interrupts::Interrupts (Cpu *cpu) :
+	_cpu(cpu),
+	_state(new (cpu->arena()->at<void>(ARENA_INTERRUPTS)) State)
+{
+	static_assert(sizeof(State) <= ARENA_TIMER - ARENA_INTERRUPTS, "the interrupts overlap the timer");
+	this->reset();
+}
+
+Gbmu::Interrupts::~Interrupts (void) {}
+
+void Gbmu::Interrupts::reset (void)
+{
+	_state->flag = 0;
+	_state->enable = 0;
+	_state->ime = false;
+	_state->eiDelay = false;
+	this->_update();
+}
+
+/*
+** A peripheral raises its line
+*/
+void Gbmu::Interrupts::request (Interrupt const& interrupt)
+{
+	_state->flag |= interrupt;
+	this->_update();
+}
+
+void Gbmu::Interrupts::onWriteIF (uint8_t const& value)
+{
+	_state->flag = value & 0x1F;
+	this->_update();
+}
+
+void Gbmu::Interrupts::onWriteIE (uint8_t const& value)
+{
+	_state->enable = value;
+	this->_update();
+}
+
+void Gbmu::Interrupts::enable (void)
+{
+	if (_state->ime == false)
+		_state->eiDelay = true;
+	this->_update();
+}
+
+void Gbmu::Interrupts::disable (void)
+{
+	_state->ime = false;
+	_state->eiDelay = false;
+	this->_update();
+}
+
+void Gbmu::Interrupts::enableNow (void)
+{
+	_state->ime = true;
+	_state->eiDelay = false;
+	this->_update();
+}
+
+/*
+** Called before an instruction when pending() is non zero
+** Wake the cpu, then jump to the vector of the highest priority interrupt
+** Return the cycles taken, 0 if the instruction still has to run
+*/
+int Gbmu::Interrupts::service (void)
+{
+	Registers*	regs = _cpu->regs();
+	Memory*		mem = _cpu->memory();
+	uint8_t		ready;
+	int			bit;
+
+	if (_state->eiDelay)							// the instruction after EI runs first
+	{
+		this->enableNow();
+		return (0);
+	}
+	ready = _state->flag & _state->enable & 0x1F;
+	if (ready == 0)
+		return (0);
+	_cpu->setHALT(false);
+	if (_state->ime == false)
+		return (0);
+	for (bit = 0; (ready & (1 << bit)) == 0; bit++)
+		;
+	_state->flag &= ~(1 << bit);
+	_state->ime = false;
+	this->_update();
+	mem->setByteAt(regs->getSP() - 1, regs->getPC() >> 8);
+	mem->setByteAt(regs->getSP() - 2, regs->getPC() & 0xFF);
+	regs->setSP(regs->getSP() - 2);
+	regs->setPC(INTERRUPT_VECTOR + bit * 8);
+	return (INTERRUPT_CYCLES);
+}
+
+/*
+** Private
+*/
+
+/*
+** Refresh the pending word and the IF / IE bytes seen through memory
+*/
+void Gbmu::Interrupts::_update (void)
+{
+	uint8_t		*data = _cpu->memory()->data();
+
+	_state->pending = (_state->flag & _state->enable & 0x1F) | (_state->eiDelay ? EI_WAITING : 0);
+	data[IO_IF] = 0xE0 | _state->flag;
+	data[IO_IE] = _state->enable;
+}
@@ -0,0 +1,61 @@
+#include "../includes/Joypad.class.hpp"
+#include <new>
+
+Gbmu::Joypad::Joypad (Cpu *cpu) :
+	_cpu(cpu),
+	_state(new (cpu->arena()->at<void>(ARENA_JOYPAD)) State)
+{
+	static_assert(sizeof(State) <= ARENA_INTERRUPTS - ARENA_JOYPAD, "the joypad overlaps the interrupts");
+	this->reset();
+}
+
+Gbmu::Joypad::~Joypad (void) {}
+
+void Gbmu::Joypad::reset (void)
+{
+	_state->buttons = 0;
+	_state->select = 0x30;
+}
+
+uint8_t Gbmu::Joypad::read (void) const
+{
+	return (0xC0 | _state->select | (~this->_lines() & 0x0F));
+}
+
+void Gbmu::Joypad::write (uint8_t const& value)
+{
+	uint8_t		before = this->_lines();
+
+	_state->select = value & 0x30;
+	if (this->_lines() & ~before)
+		_cpu->interrupts()->request(Interrupts::JOYPAD);
+}
+
+void Gbmu::Joypad::setButtons (uint8_t const& buttons)
+{
+	uint8_t		before = this->_lines();
+
+	_state->buttons = buttons;
+	if (this->_lines() & ~before)
+		_cpu->interrupts()->request(Interrupts::JOYPAD);
+}
+
+uint8_t const& Gbmu::Joypad::buttons (void) const
+{
+	return (_state->buttons);
+}
+
+/*
+** Private
+*/
+
+uint8_t Gbmu::Joypad::_lines (void) const
+{
+	uint8_t		lines = 0;
+
+	if ((_state->select & 0x20) == 0)
+		lines |= _state->buttons & 0x0F;
+	if ((_state->select & 0x10) == 0)
+		lines |= _state->buttons >> 4;
+	return (lines);
+}
@@ -0,0 +1,291 @@
+#include "../includes/Lockstep.class.hpp"
+#include <sstream>
+#include <iomanip>
+#include <cstring>
+#include <algorithm>
+
+Gbmu::Lockstep::Lockstep (size_t const& interval) :
+	_reference(new Gbmu::Cpu(true)),
+	_optimized(new Gbmu::Cpu(false)),
+	_interval(interval > 0 ? interval : 1),
+	_instructions(0),
+	_checked(0),
+	_pc(0),
+	_pixels(new uint32_t[SCREEN_WIDTH * SCREEN_HEIGHT]()),
+	_halted(false)
+{
+	std::memset(_opcode, 0, sizeof(_opcode));
+	_optimized->ppu()->setThreaded(true);
+}
+
+Gbmu::Lockstep::~Lockstep (void)
+{
+	delete _optimized;
+	delete _reference;
+	delete[] _pixels;
+}
+
+void Gbmu::Lockstep::load (std::string const& cartridgePath, Gb::Model const& model)
+{
+	_reference->loadCartridge(cartridgePath, model);
+	_optimized->loadCartridge(cartridgePath, model);
+	_instructions = 0;
+	_report.clear();
+	this->_check();
+}
+
+bool Gbmu::Lockstep::loadState (SaveState& state)
+{
+	if (!(_reference->loadState(state) && _optimized->loadState(state)))
+		return (false);
+	_instructions = 0;
+	_report.clear();
+	return (this->_check());
+}
+
+void Gbmu::Lockstep::setButtons (uint8_t const& buttons)
+{
+	_reference->joypad()->setButtons(buttons);
+	_optimized->joypad()->setButtons(buttons);
+}
+
+bool Gbmu::Lockstep::run (uint64_t const& instructions)
+{
+	for (uint64_t i = 0; i < instructions; i++)
+	{
+		this->_step();
+		if (_instructions - _checked >= _interval && this->_check() == false)
+			return (false);
+	}
+	return (this->_check());
+}
+
+/*
+** Like Cpu::runFrame, the optimized cpu follows at each comparison
+*/
+bool Gbmu::Lockstep::runFrame (void)
+{
+	uint64_t	frame = _reference->ppu()->frame();
+
+	while (_reference->ppu()->frame() == frame)
+	{
+		this->_step();
+		if (_instructions - _checked >= _interval && this->_check() == false)
+			return (false);
+	}
+	if (this->_sync() == false)
+	{
+		this->_locate();
+		return (false);
+	}
+	_reference->apu()->sync();
+	_optimized->apu()->sync();
+	return (this->_check());
+}
+
+uint64_t const& Gbmu::Lockstep::instructions (void) const
+{
+	return (_instructions);
+}
+
+std::string const& Gbmu::Lockstep::report (void) const
+{
+	return (_report);
+}
+
+Gbmu::Cpu* Gbmu::Lockstep::reference (void) const
+{
+	return (_reference);
+}
+
+Gbmu::Cpu* Gbmu::Lockstep::optimized (void) const
+{
+	return (_optimized);
+}
+
+/*
+** Private
+*/
+
+/*
+** One reference instruction, remembered for the report
+*/
+void Gbmu::Lockstep::_step (void)
+{
+	Memory		*memory = _reference->memory();
+
+	_pc = _reference->regs()->getPC();
+	_opcode[0] = memory->getByteAt(_pc);
+	_opcode[1] = memory->getByteAt(_pc + 1);
+	_halted = _reference->onHalt();
+	_reference->step();
+	_instructions++;
+}
+
+/*
+** Compare, snapshot both when they agree
+*/
+bool Gbmu::Lockstep::_check (void)
+{
+	if (this->_sync() == false)
+	{
+		this->_locate();
+		return (false);
+	}
+	_checked = _instructions;
+	_referenceState.clear();
+	_reference->saveState(_referenceState);
+	_optimizedState.clear();
+	_optimized->saveState(_optimizedState);
+	std::memcpy(_pixels, _frame(_reference), SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint32_t));
+	return (true);
+}
+
+/*
+** The optimized cpu stops on the first instruction boundary at or after
+** the reference clock: the same one when both agree
+*/
+bool Gbmu::Lockstep::_sync (void)
+{
+	uint64_t	now = _reference->scheduler()->now();
+	uint64_t	optimized = _optimized->scheduler()->now();
+
+	if (optimized < now)
+		_optimized->runFor(now - optimized);
+	return (this->_same());
+}
+
+bool Gbmu::Lockstep::_same (void) const
+{
+	Registers	*a = _reference->regs();
+	Registers	*b = _optimized->regs();
+
+	if (_reference->scheduler()->now() != _optimized->scheduler()->now()
+		|| a->getAF() != b->getAF() || a->getBC() != b->getBC()
+		|| a->getDE() != b->getDE() || a->getHL() != b->getHL()
+		|| a->getPC() != b->getPC() || a->getSP() != b->getSP()
+		|| _reference->onHalt() != _optimized->onHalt())
+		return (false);
+	for (size_t page = LOCKSTEP_FIRST_PAGE; page < LOCKSTEP_PAGES; page++)
+		if (HashLog::hash(_page(_reference, page), _pageSize(page))
+			!= HashLog::hash(_page(_optimized, page), _pageSize(page)))
+			return (false);
+	return (HashLog::hash(_frame(_reference), SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint32_t))
+		== HashLog::hash(_frame(_optimized), SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint32_t)));
+}
+
+/*
+** Back to the last agreement, then compared after every instruction
+*/
+void Gbmu::Lockstep::_locate (void)
+{
+	uint64_t	diverged = _instructions;
+
+	if (_reference->restore(_referenceState) && _optimized->restore(_optimizedState))
+	{
+		_reference->ppu()->setFrameBuffer(_pixels);
+		_optimized->ppu()->setFrameBuffer(_pixels);
+		_instructions = _checked;
+		while (_instructions < diverged)
+		{
+			this->_step();
+			if (this->_sync() == false)
+				break ;
+		}
+	}
+	this->_describe();
+}
+
+void Gbmu::Lockstep::_describe (void)
+{
+	std::ostringstream	out;
+	Registers			*a = _reference->regs();
+	Registers			*b = _optimized->regs();
+	char const*			names[] = { "AF", "BC", "DE", "HL", "PC", "SP" };
+	uint16_t			ra[] = { a->getAF(), a->getBC(), a->getDE(), a->getHL(), a->getPC(), a->getSP() };
+	uint16_t			rb[] = { b->getAF(), b->getBC(), b->getDE(), b->getHL(), b->getPC(), b->getSP() };
+	uint8_t const		*pa, *pb;
+	uint32_t const		*fa, *fb;
+	size_t				first, count;
+
+	out << std::hex << std::setfill('0');
+	out << "first divergence after " << std::dec << _instructions << std::hex
+		<< " instructions, cycle 0x" << _reference->scheduler()->now() << std::endl;
+	out << "pc 0x" << std::setw(4) << _pc << ": ";
+	if (_halted)
+		out << "halted" << std::endl;
+	else
+	{
+		out << "0x" << std::setw(2) << +_opcode[0];
+		if (_opcode[0] == 0xcb)
+			out << " 0x" << std::setw(2) << +_opcode[1];
+		out << " " << _reference->instructions()->name(_opcode[0], _opcode[1]) << std::endl;
+	}
+	out << "              reference    optimized" << std::endl;
+	if (_reference->scheduler()->now() != _optimized->scheduler()->now())
+		out << "  cycle       0x" << _reference->scheduler()->now()
+			<< "  0x" << _optimized->scheduler()->now() << std::endl;
+	for (int r = 0; r < 6; r++)
+		if (ra[r] != rb[r])
+			out << "  " << names[r] << "          0x" << std::setw(4) << ra[r]
+				<< "       0x" << std::setw(4) << rb[r] << std::endl;
+	if (_reference->onHalt() != _optimized->onHalt())
+		out << "  HALT        " << _reference->onHalt() << "            "
+			<< _optimized->onHalt() << std::endl;
+	for (size_t page = LOCKSTEP_FIRST_PAGE; page < LOCKSTEP_PAGES; page++)
+	{
+		pa = _page(_reference, page);
+		pb = _page(_optimized, page);
+		count = 0;
+		first = 0;
+		for (size_t i = _pageSize(page); i-- > 0; )
+			if (pa[i] != pb[i])
+			{
+				first = i;
+				count++;
+			}
+		if (count == 0)
+			continue ;
+		out << "  page 0x" << std::setw(4) << page * LOCKSTEP_PAGE_SIZE
+			<< " 0x" << std::setw(4) << (pa - _reference->arena()->base()) + first << ": 0x" << std::setw(2) << +pa[first] << " != 0x" << std::setw(2) << +pb[first]
+			<< " ( " << std::dec << count << (count > 1 ? " bytes )" : " byte )") << std::hex << std::endl;
+	}
+	fa = _frame(_reference);
+	fb = _frame(_optimized);
+	count = 0;
+	first = 0;
+	for (size_t i = SCREEN_WIDTH * SCREEN_HEIGHT; i-- > 0; )
+		if (fa[i] != fb[i])
+		{
+			first = i;
+			count++;
+		}
+	if (count)
+		out << "  pixels " << std::dec << first % SCREEN_WIDTH << "," << first / SCREEN_WIDTH << std::hex
+			<< ": 0x" << std::setw(8) << fa[first] << " != 0x" << std::setw(8) << fb[first]
+			<< " ( " << std::dec << count << (count > 1 ? " pixels )" : " pixel )") << std::hex << std::endl;
+	_report = out.str();
+}
+
+/*
+** Arena pages, from 0x8000 their offset is their address
+** The first one starts at ARENA_LIVE, below is never used
+*/
+uint8_t const* Gbmu::Lockstep::_page (Cpu const* cpu, size_t const& page)
+{
+	return (cpu->arena()->base() + std::max<size_t>(page * LOCKSTEP_PAGE_SIZE, ARENA_LIVE));
+}
+
+size_t Gbmu::Lockstep::_pageSize (size_t const& page)
+{
+	return ((page + 1) * LOCKSTEP_PAGE_SIZE - std::max<size_t>(page * LOCKSTEP_PAGE_SIZE, ARENA_LIVE));
+}
+
+/*
+** Frame buffer as drawn so far, the render thread done with its log
+*/
+uint32_t const* Gbmu::Lockstep::_frame (Cpu* cpu)
+{
+	cpu->ppu()->flush();
+	return (cpu->ppu()->frameBuffer());
+}
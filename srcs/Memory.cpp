@@ -1,8 +1,22 @@
 #include "../includes/Memory.class.hpp"
+#include "../includes/Ppu.class.hpp"
+#include "../includes/Timer.class.hpp"
+#include "../includes/Interrupts.class.hpp"
+#include "../includes/Apu.class.hpp"
 
-Gbmu::Memory::Memory (void) :
-	_data(new uint8_t[GB_MEM_SIZE])
+static uint8_t const		g_noRom[CARTRIDGE_SIZE] = {};
+
+Gbmu::Memory::Memory (Cpu *cpu, StateArena *arena) :
+	_cpu(cpu),
+	_rom(g_noRom),
+	_data(arena->base()),
+	_vram(arena->at<uint8_t>(ARENA_VRAM)),
+	_bcp(arena->at<uint8_t>(ARENA_BCP)),
+	_ocp(arena->at<uint8_t>(ARENA_OCP)),
+	_bcpRgb(arena->at<uint32_t>(ARENA_BCP_RGB)),
+	_ocpRgb(arena->at<uint32_t>(ARENA_OCP_RGB))
 {
+	this->reset();
 }
 
 Gbmu::Memory::Memory (Memory const & src)
@@ -10,10 +24,7 @@ Gbmu::Memory::Memory (Memory const & src)
 	(void)src;
 }
 
-Gbmu::Memory::~Memory (void)
-{
-	delete[] _data;
-}
+Gbmu::Memory::~Memory (void) {}
 
 Gbmu::Memory & Gbmu::Memory::operator=(Memory const & rhs)
 {
@@ -21,10 +32,97 @@ Gbmu::Memory & Gbmu::Memory::operator=(Memory const & rhs)
 	return *this;
 }
 
+/*
+** Power on state: everything zeroed, white palettes, VRAM bank 0
+*/
+void Gbmu::Memory::reset (void)
+{
+	std::memset(_data + ARENA_MAP, 0, GB_MEM_SIZE - ARENA_MAP);
+	std::memset(_vram, 0, VRAM_SIZE);
+	_vramBankPtr = _vram;
+	std::memset(_bcp, 0xFF, BCP_SIZE);	// palettes are white after the boot
+	std::memset(_ocp, 0xFF, OCP_SIZE);
+	for (int i = 0; i < PALETTE_COLORS; i++)
+	{
+		_bcpRgb[i] = rgb555ToArgb(0xFF, 0xFF);
+		_ocpRgb[i] = rgb555ToArgb(0xFF, 0xFF);
+	}
+}
+
+void Gbmu::Memory::setRom (uint8_t const* rom)
+{
+	_rom = rom ? rom : g_noRom;
+}
+
+void Gbmu::Memory::remap (void)
+{
+	_vramBankPtr = _vram + (_data[IO_VBK] & 0x01) * VRAM_BANK_SIZE;
+}
+
+/*
+** OAM DMA: copy 0xXX00 - 0xXX9F to OAM
+** Done at once, through setByteAt so the ppu sees every OAM change
+*/
+void Gbmu::Memory::onWriteDMA( uint8_t const& value )
+{
+	uint16_t	src = value << 8;
+
+	for (uint16_t i = 0; i < OAM_SIZE; i++)
+		setByteAt(OAM_ADDR + i, getByteAt(src + i));
+}
+
+/*
+** Select the VRAM bank mapped at 0x8000
+*/
 void Gbmu::Memory::onWriteVBK( uint8_t const& value )
 {
-	(void)value;
-	// this->_data = value;
+	_vramBankPtr = _vram + (value & 0x01) * VRAM_BANK_SIZE;
+	_data[IO_VBK] = 0xFE | (value & 0x01);
+}
+
+/*
+** Palette specs: keep BCPD/OCPD readable as the palette byte at the new index
+*/
+void Gbmu::Memory::onWriteBCPS( uint8_t const& value )
+{
+	_data[IO_BCPS] = value & 0xBF;
+	_data[IO_BCPD] = _bcp[value & 0x3F];
+}
+
+void Gbmu::Memory::onWriteOCPS( uint8_t const& value )
+{
+	_data[IO_OCPS] = value & 0xBF;
+	_data[IO_OCPD] = _ocp[value & 0x3F];
+}
+
+void Gbmu::Memory::onWriteBCPD( uint8_t const& value )
+{
+	_writePalette(IO_BCPS, _bcp, _bcpRgb, value);
+}
+
+void Gbmu::Memory::onWriteOCPD( uint8_t const& value )
+{
+	_writePalette(IO_OCPS, _ocp, _ocpRgb, value);
+}
+
+/**
+ * Convert one CGB color to 0xAARRGGBB
+ * 5 bits components are expanded to 8 bits ( 0x1F -> 0xFF )
+ *
+ * @param lsb - GGGRRRRR
+ * @param hsb - xBBBBBGG
+ */
+uint32_t Gbmu::Memory::rgb555ToArgb( uint8_t const& lsb, uint8_t const& hsb )
+{
+	uint16_t	color = lsb | (hsb << 8);
+	uint32_t	r = color & 0x1F;
+	uint32_t	g = (color >> 5) & 0x1F;
+	uint32_t	b = (color >> 10) & 0x1F;
+
+	r = (r << 3) | (r >> 2);
+	g = (g << 3) | (g >> 2);
+	b = (b << 3) | (b >> 2);
+	return (0xFF000000 | (r << 16) | (g << 8) | b);
 }
 
 
@@ -34,6 +132,12 @@ void Gbmu::Memory::onWriteVBK( uint8_t const& value )
   * @return The byte at addr in gb memory
  */
 uint8_t Gbmu::Memory::getByteAt(uint16_t const& addr) const {
+	if (addr < CARTRIDGE_SIZE)								// 0x0000 - 0x7FFF
+		return _rom[addr];
+	if ((addr & 0xE000) == VRAM_ADDR)						// 0x8000 - 0x9FFF
+		return _vramBankPtr[addr - VRAM_ADDR];
+	if ((addr & 0xFFC0) == IO_ADDR)							// 0xFF00 - 0xFF3F
+		return this->_readIO(addr);
 	return _data[addr];
 }
 
@@ -42,7 +146,7 @@ uint8_t Gbmu::Memory::getByteAt(uint16_t const& addr) const {
  * addr = low byte; addr + 1 = high byte
  */
 uint16_t	Gbmu::Memory::getWordAt(uint16_t const &addr) {
-	return (_data[addr] | (_data[addr + 1] << 8));
+	return (getByteAt(addr) | (getByteAt(addr + 1) << 8));
 }
 
 /**
@@ -51,5 +155,87 @@ uint16_t	Gbmu::Memory::getWordAt(uint16_t const &addr) {
   * @param value Value we set at addr
  */
 void Gbmu::Memory::setByteAt(const uint16_t &addr, const uint8_t &value) {
+	uint16_t	offset;
+
+	if (addr < CARTRIDGE_SIZE)								// ROM, no MBC yet
+		return ;
+	if ((addr & 0xE000) == VRAM_ADDR)						// 0x8000 - 0x9FFF
+	{
+		offset = (_vramBankPtr - _vram) + (addr - VRAM_ADDR);
+		_vram[offset] = value;
+		_cpu->ppu()->onWriteVram(offset, value);
+		return ;
+	}
 	_data[addr] = value;
+	if (addr < OAM_ADDR)
+		return ;
+	if (addr < OAM_ADDR + OAM_SIZE)							// 0xFE00 - 0xFE9F
+		_cpu->ppu()->onWriteOam(addr, value);
+	else if (addr >= IO_NR10 && addr < IO_NR10 + APU_REG_SIZE)	// 0xFF10 - 0xFF3F
+		_cpu->apu()->write(addr, value);
+	else switch (addr)
+	{
+		case IO_P1: _cpu->joypad()->write(value); break;
+		case IO_DIV: _cpu->timer()->onWriteDIV(); break;
+		case IO_TIMA: _cpu->timer()->onWriteTIMA(value); break;
+		case IO_TMA: _cpu->timer()->onWriteTMA(value); break;
+		case IO_TAC: _cpu->timer()->onWriteTAC(value); break;
+		case IO_IF: _cpu->interrupts()->onWriteIF(value); break;
+		case IO_IE: _cpu->interrupts()->onWriteIE(value); break;
+		case IO_DMA: onWriteDMA(value); break;
+		case IO_VBK: onWriteVBK(value); break;
+		case IO_BCPS: onWriteBCPS(value); break;
+		case IO_BCPD: onWriteBCPD(value); break;
+		case IO_OCPS: onWriteOCPS(value); break;
+		case IO_OCPD: onWriteOCPD(value); break;
+	}
+}
+
+uint8_t *Gbmu::Memory::data(void) const { return (_data); }
+uint8_t *Gbmu::Memory::vram(void) const { return (_vram); }
+uint8_t *Gbmu::Memory::vramBankPtr(void) const { return (_vramBankPtr); }
+uint8_t *Gbmu::Memory::bcp(void) const { return (_bcp); }
+uint8_t *Gbmu::Memory::ocp(void) const { return (_ocp); }
+uint32_t const *Gbmu::Memory::bcpRgb(void) const { return (_bcpRgb); }
+uint32_t const *Gbmu::Memory::ocpRgb(void) const { return (_ocpRgb); }
+
+/*
+** Private
+*/
+
+/*
+** Registers kept by the components ( joypad, timer, apu ), computed on read
+*/
+uint8_t Gbmu::Memory::_readIO(uint16_t const& addr) const {
+	switch (addr)
+	{
+		case IO_P1: return _cpu->joypad()->read();
+		case IO_DIV: return _cpu->timer()->div();
+		case IO_TIMA: return _cpu->timer()->tima();
+		case IO_TMA: return _cpu->timer()->tma();
+		case IO_TAC: return _cpu->timer()->tac();
+	}
+	if (addr >= IO_NR10)
+		return _cpu->apu()->read(addr);
+	return _data[addr];
+}
+
+/**
+ * Write one palette byte at the index of the specs register,
+ * refresh its converted color and auto increment the index ( bit 7 )
+ *
+ * @param specs - BCPS or OCPS address
+ * @param palette - palette RAM
+ * @param rgb - converted colors of this palette RAM
+ * @param value - written byte
+ */
+void Gbmu::Memory::_writePalette(uint16_t const& specs, uint8_t* palette, uint32_t* rgb, uint8_t const& value) {
+	uint8_t		index = _data[specs] & 0x3F;
+
+	palette[index] = value;
+	rgb[index >> 1] = rgb555ToArgb(palette[index & 0x3E], palette[index | 0x01]);
+	_cpu->ppu()->onWritePalette(specs == IO_OCPS, index, value);
+	if (_data[specs] & 0x80)
+		_data[specs] = 0x80 | ((index + 1) & 0x3F);
+	_data[specs + 1] = palette[_data[specs] & 0x3F];		// BCPD / OCPD read back
 }
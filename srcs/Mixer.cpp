@@ -0,0 +1,83 @@
+#include "../includes/Mixer.class.hpp"
+#include <algorithm>
+#include <cstring>
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
+
+Gbmu::Mixer::Mixer (void)
+{
+	this->setGains(0x77, 0xFF, false);
+}
+
+Gbmu::Mixer::~Mixer (void) {}
+
+void Gbmu::Mixer::setGains (uint8_t const& nr50, uint8_t const& nr51, bool const& muted)
+{
+	float	left = muted ? 0 : (((nr50 >> 4) & 0x07) + 1) * MIXER_SCALE;
+	float	right = muted ? 0 : ((nr50 & 0x07) + 1) * MIXER_SCALE;
+
+	for (int c = 0; c < MIXER_CHANNELS; c++)
+	{
+		_left[c] = (nr51 & (0x10 << c)) ? left : 0;
+		_right[c] = (nr51 & (0x01 << c)) ? right : 0;
+	}
+}
+
+#ifdef __SSE2__
+
+void Gbmu::Mixer::mix (float const* const* channels, AudioSample *out, size_t const& count) const
+{
+	__m128		gl[MIXER_CHANNELS], gr[MIXER_CHANNELS];
+	__m128		in, left, right;
+	__m128i		l16, r16;
+	int16_t		packed[8];
+
+	for (int c = 0; c < MIXER_CHANNELS; c++)
+	{
+		gl[c] = _mm_set1_ps(_left[c]);
+		gr[c] = _mm_set1_ps(_right[c]);
+	}
+	for (size_t i = 0; i < count; i += 4)
+	{
+		left = _mm_setzero_ps();
+		right = _mm_setzero_ps();
+		for (int c = 0; c < MIXER_CHANNELS; c++)
+		{
+			in = _mm_loadu_ps(channels[c] + i);
+			left = _mm_add_ps(left, _mm_mul_ps(in, gl[c]));
+			right = _mm_add_ps(right, _mm_mul_ps(in, gr[c]));
+		}
+		l16 = _mm_packs_epi32(_mm_cvtps_epi32(left), _mm_setzero_si128());	// saturated to 16 bits
+		r16 = _mm_packs_epi32(_mm_cvtps_epi32(right), _mm_setzero_si128());
+		if (i + 4 <= count)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi16(l16, r16));
+		else
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(packed), _mm_unpacklo_epi16(l16, r16));
+			std::memcpy(out + i, packed, (count - i) * sizeof(AudioSample));
+		}
+	}
+}
+
+#else
+
+void Gbmu::Mixer::mix (float const* const* channels, AudioSample *out, size_t const& count) const
+{
+	float	left, right;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		left = 0;
+		right = 0;
+		for (int c = 0; c < MIXER_CHANNELS; c++)
+		{
+			left += channels[c][i] * _left[c];
+			right += channels[c][i] * _right[c];
+		}
+		out[i].left = std::max(-32768.0f, std::min(32767.0f, left));
+		out[i].right = std::max(-32768.0f, std::min(32767.0f, right));
+	}
+}
+
+#endif
@@ -0,0 +1,119 @@
+#include "../includes/Movie.class.hpp"
+#include <cstdio>
+#include <cstring>
+
+Gbmu::Movie::Movie (void) :
+	_mode(NONE),
+	_romHash(0),
+	_frame(0)
+{}
+
+Gbmu::Movie::~Movie (void) {}
+
+void Gbmu::Movie::record (uint64_t const& romHash)
+{
+	_romHash = romHash;
+	_inputs.clear();
+	_inputs.reserve(0x10000);		// 18 minutes before the first reallocation
+	_frame = 0;
+	_mode = RECORD;
+}
+
+void Gbmu::Movie::play (void)
+{
+	_frame = 0;
+	_mode = _inputs.empty() ? NONE : PLAY;
+}
+
+void Gbmu::Movie::stop (void)
+{
+	_mode = NONE;
+}
+
+/*
+** Header, state and keys in one buffer, one write
+*/
+bool Gbmu::Movie::save (std::string const& path) const
+{
+	std::vector<uint8_t>	buffer(MOVIE_HEADER_SIZE + _state.size() + _inputs.size());
+	uint8_t*				out = &buffer[0];
+	uint16_t				format = MOVIE_FORMAT;
+	uint16_t				reserved = 0;
+	uint32_t				frames = _inputs.size();
+	uint32_t				stateSize = _state.size();
+	FILE*					file;
+	bool					ok;
+
+	std::memcpy(out, MOVIE_MAGIC, 4);
+	std::memcpy(out + 4, &format, 2);
+	std::memcpy(out + 6, &reserved, 2);
+	std::memcpy(out + 8, &_romHash, 8);
+	std::memcpy(out + 16, &frames, 4);
+	std::memcpy(out + 20, &stateSize, 4);
+	std::memcpy(out + MOVIE_HEADER_SIZE, _state.data(), stateSize);
+	if (frames > 0)
+		std::memcpy(out + MOVIE_HEADER_SIZE + stateSize, &_inputs[0], frames);
+	if ((file = fopen(path.c_str(), "wb")) == NULL)
+		return (false);
+	ok = fwrite(out, 1, buffer.size(), file) == buffer.size();
+	return (fclose(file) == 0 && ok);
+}
+
+/*
+** False when the file is not a whole movie of this format
+*/
+bool Gbmu::Movie::load (std::string const& path)
+{
+	std::vector<uint8_t>	buffer;
+	uint16_t				format;
+	uint32_t				frames;
+	uint32_t				stateSize;
+	FILE*					file;
+	long					size;
+	bool					ok;
+
+	if ((file = fopen(path.c_str(), "rb")) == NULL)
+		return (false);
+	ok = fseek(file, 0, SEEK_END) == 0 && (size = ftell(file)) >= MOVIE_HEADER_SIZE
+		&& fseek(file, 0, SEEK_SET) == 0;
+	if (ok)
+	{
+		buffer.resize(size);
+		ok = fread(&buffer[0], 1, size, file) == buffer.size();
+	}
+	fclose(file);
+	if (ok == false || std::memcmp(&buffer[0], MOVIE_MAGIC, 4) != 0)
+		return (false);
+	std::memcpy(&format, &buffer[4], 2);
+	std::memcpy(&frames, &buffer[16], 4);
+	std::memcpy(&stateSize, &buffer[20], 4);
+	if (format != MOVIE_FORMAT
+		|| buffer.size() != MOVIE_HEADER_SIZE + static_cast<size_t>(stateSize) + frames
+		|| _state.assign(&buffer[MOVIE_HEADER_SIZE], stateSize) == false)
+		return (false);
+	std::memcpy(&_romHash, &buffer[8], 8);
+	_inputs.assign(buffer.begin() + MOVIE_HEADER_SIZE + stateSize, buffer.end());
+	_frame = 0;
+	_mode = NONE;
+	return (true);
+}
+
+Gbmu::Movie::Mode const& Gbmu::Movie::mode (void) const
+{
+	return (_mode);
+}
+
+uint64_t const& Gbmu::Movie::romHash (void) const
+{
+	return (_romHash);
+}
+
+Gbmu::SaveState& Gbmu::Movie::state (void)
+{
+	return (_state);
+}
+
+size_t Gbmu::Movie::frames (void) const
+{
+	return (_inputs.size());
+}
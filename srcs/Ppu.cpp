@@ -0,0 +1,693 @@
+#include "../includes/Ppu.class.hpp"
+#include "../includes/Interrupts.class.hpp"
+#include <new>
+
+/*
+** DMG shades, color 0 (white) to color 3 (black)
+*/
+static const uint32_t	g_dmgColors[4] = {
+	0xFFFFFFFF,
+	0xFFAAAAAA,
+	0xFF555555,
+	0xFF000000
+};
+
+Gbmu::Ppu::Ppu (Cpu *cpu) :
+	_cpu(cpu),
+	_state(new (cpu->arena()->at<void>(ARENA_PPU)) State),
+	_screen(NULL),
+	_hashLog(NULL),
+	_pixels(new uint32_t[SCREEN_WIDTH * SCREEN_HEIGHT]()),
+	_threaded(false),
+	_thread(NULL),
+	_log(new Log),
+	_threadVram(new uint8_t[VRAM_SIZE]()),
+	_threadOam(new uint8_t[OAM_SIZE]()),
+	_threadBcp(new uint8_t[BCP_SIZE + OCP_SIZE]()),
+	_threadRgb(new uint32_t[PALETTE_COLORS * 2]()),
+	_threadColor(false),
+	_framesRendered(0),
+	_idle(false),
+	_waiting(false)
+{
+	static_assert(sizeof(State) <= ARENA_SCHEDULER - ARENA_PPU, "the ppu overlaps the scheduler");
+	this->reset();
+}
+
+Gbmu::Ppu::~Ppu (void)
+{
+	this->setThreaded(false);	// join the render thread
+	delete[] _pixels;
+	delete _log;
+	delete[] _threadVram;
+	delete[] _threadOam;
+	delete[] _threadBcp;
+	delete[] _threadRgb;
+}
+
+void Gbmu::Ppu::reset (void)
+{
+	_state->ly = 0;
+	_state->windowLine = 0;
+	_state->frame = 0;
+	_state->color = false;
+	_sprites.dirty = true;
+	_framesRendered.store(0);
+	_state->lineStart = _cpu->scheduler()->now();
+	_state->mode = 0;
+	this->_setMode(2);
+	_cpu->scheduler()->setHandler(Scheduler::PPU, &Gbmu::Ppu::_onEvent, this);
+	_cpu->scheduler()->schedule(Scheduler::PPU, _state->lineStart + OAM_CYCLES);
+}
+
+/*
+** The frame being drawn keeps the pixels it had, its first lines are
+** only drawn again by the next frame
+** The render thread sleeps on an empty log, it reads its frame count and
+** its copy of the memory again when woken
+*/
+void Gbmu::Ppu::onRestore (void)
+{
+	_sprites.dirty = true;
+	if (_threaded && _threadColor != _state->color)
+	{
+		this->setThreaded(false);
+		this->setThreaded(true);
+		return ;
+	}
+	_framesRendered.store(_state->frame);
+	if (_threaded)
+		this->_copyMemory();
+}
+
+/*
+** Memory write hooks. Inline rendering reads memory directly,
+** the render thread needs every change to keep its own copy in sync
+** VRAM writes are given as an offset in the 2 banks ( 0x0000 - 0x3FFF )
+*/
+void Gbmu::Ppu::onWriteVram (uint16_t const& addr, uint8_t const& value)
+{
+	LogEntry	entry;
+
+	if (_threaded == false)
+		return ;
+	entry.type = LOG_VRAM;
+	entry.addr = addr;
+	entry.value = value;
+	this->_post(entry);
+}
+
+void Gbmu::Ppu::onWriteOam (uint16_t const& addr, uint8_t const& value)
+{
+	LogEntry	entry;
+
+	_sprites.dirty = true;
+	if (_threaded == false)
+		return ;
+	entry.type = LOG_OAM;
+	entry.addr = addr;
+	entry.value = value;
+	this->_post(entry);
+}
+
+void Gbmu::Ppu::onWritePalette (bool const& obj, uint8_t const& index, uint8_t const& value)
+{
+	LogEntry	entry;
+
+	if (_threaded == false)
+		return ;
+	entry.type = obj ? LOG_OCP : LOG_BCP;
+	entry.addr = index;
+	entry.value = value;
+	this->_post(entry);
+}
+
+void Gbmu::Ppu::setScreen (IScreen* screen)
+{
+	this->sync();
+	_screen = screen;
+}
+
+/*
+** Hash every completed frame in log, NULL to stop
+*/
+void Gbmu::Ppu::setHashLog (HashLog* log)
+{
+	this->sync();
+	_hashLog = log;
+}
+
+/*
+** Switch between inline and threaded rendering
+** The render thread starts from a copy of the current VRAM/OAM/palettes
+*/
+void Gbmu::Ppu::setThreaded (bool const& b)
+{
+	LogEntry	entry;
+
+	if (b == _threaded)
+		return ;
+	if (b)
+	{
+		this->_copyMemory();
+		_threadColor = _state->color;
+		_framesRendered.store(_state->frame);
+		_log->clear();
+		_idle.store(false);
+		_threaded = true;
+		_thread = new std::thread(&Gbmu::Ppu::_renderLoop, this);
+	}
+	else
+	{
+		entry.type = LOG_STOP;
+		this->_post(entry);
+		_thread->join();
+		delete _thread;
+		_thread = NULL;
+		_threaded = false;
+	}
+}
+
+bool Gbmu::Ppu::threaded (void) const
+{
+	return (_threaded);
+}
+
+/*
+** CGB rendering ( VRAM bank 1 attributes and color palettes )
+*/
+void Gbmu::Ppu::setColor (bool const& b)
+{
+	bool	threaded = _threaded;
+
+	this->setThreaded(false);		// the render thread reads the color when it starts
+	_state->color = b;
+	this->setThreaded(threaded);
+}
+
+bool Gbmu::Ppu::color (void) const
+{
+	return (_state->color);
+}
+
+/*
+** Wait until the render thread completed every frame the cpu side completed
+*/
+void Gbmu::Ppu::sync (void)
+{
+	if (_threaded == false)
+		return ;
+	this->_wait(&Ppu::_caughtUp);
+}
+
+/*
+** Wait until the render thread drew every line logged and sleeps
+*/
+void Gbmu::Ppu::flush (void)
+{
+	if (_threaded == false)
+		return ;
+	this->_wait(&Ppu::_drained);
+}
+
+uint64_t Gbmu::Ppu::frame (void) const
+{
+	return (_state->frame);
+}
+
+uint8_t Gbmu::Ppu::ly (void) const
+{
+	return (_state->ly);
+}
+
+/*
+** Last completed frame
+*/
+uint32_t const* Gbmu::Ppu::frameBuffer (void)
+{
+	this->sync();
+	return (_pixels);
+}
+
+/*
+** Pixels kept aside by the caller, put back after a restore
+*/
+void Gbmu::Ppu::setFrameBuffer (uint32_t const* pixels)
+{
+	std::memcpy(_pixels, pixels, SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint32_t));
+}
+
+/**
+ * Render one line of pixels
+ * Shared by inline and threaded mode so both produce the same pixels
+ *
+ * @param state - registers at the start of mode 3
+ * @param src - VRAM, OAM and converted CGB colors to read
+ * @param line - SCREEN_WIDTH pixels to fill
+ */
+void Gbmu::Ppu::renderLine (LineState const& state, Source const& src, uint32_t* line)
+{
+	uint8_t		bgColor[SCREEN_WIDTH];	// color index before palette ( used by OBJ priority )
+	uint8_t		bgAttr[SCREEN_WIDTH];	// CGB BG attributes ( bit 7: BG over OBJ )
+	bool		objDone[SCREEN_WIDTH];	// pixel already owned by a higher priority OBJ
+	uint32_t	dmg[3][4];				// BGP, OBP0, OBP1 shades of this line
+	uint8_t const*	visible;			// OBJ of this line in priority order
+	int			count;
+	uint8_t		height;
+	uint16_t	map;
+	uint16_t	tile;
+	uint8_t		attr, x, y, px, color, lo, hi;
+	int			winX;
+	bool		bgOn;
+
+	if ((state.lcdc & 0x80) == 0)		// LCD off
+	{
+		for (int i = 0; i < SCREEN_WIDTH; i++)
+			line[i] = g_dmgColors[0];
+		return ;
+	}
+	for (int i = 0; i < 4; i++)
+	{
+		dmg[0][i] = g_dmgColors[(state.bgp >> (i * 2)) & 3];
+		dmg[1][i] = g_dmgColors[(state.obp0 >> (i * 2)) & 3];
+		dmg[2][i] = g_dmgColors[(state.obp1 >> (i * 2)) & 3];
+	}
+
+	// Background and window ( on CGB LCDC bit 0 is the BG priority, BG is always drawn )
+	bgOn = src.color || (state.lcdc & 0x01);
+	std::memset(bgColor, 0, sizeof(bgColor));
+	std::memset(bgAttr, 0, sizeof(bgAttr));
+	if (bgOn)
+	{
+		winX = SCREEN_WIDTH;
+		if ((state.lcdc & 0x20) && state.ly >= state.wy && state.wx <= 166)
+			winX = (state.wx < 7) ? 0 : state.wx - 7;
+		for (int i = 0; i < SCREEN_WIDTH; i++)
+		{
+			if (i < winX)
+			{
+				map = (state.lcdc & 0x08) ? 0x1C00 : 0x1800;
+				x = state.scx + i;
+				y = state.scy + state.ly;
+			}
+			else
+			{
+				map = (state.lcdc & 0x40) ? 0x1C00 : 0x1800;
+				x = i - winX;
+				y = state.windowLine;
+			}
+			map += (y >> 3) * 32 + (x >> 3);
+			tile = src.vram[map];
+			attr = src.color ? src.vram[VRAM_BANK_SIZE + map] : 0;
+			if (state.lcdc & 0x10)
+				tile = tile * 16;
+			else
+				tile = 0x1000 + static_cast<int8_t>(tile) * 16;
+			if (attr & 0x08)				// tile in VRAM bank 1
+				tile += VRAM_BANK_SIZE;
+			y = (attr & 0x40) ? 7 - (y & 7) : (y & 7);
+			lo = src.vram[tile + y * 2];
+			hi = src.vram[tile + y * 2 + 1];
+			px = (attr & 0x20) ? (x & 7) : 7 - (x & 7);
+			bgColor[i] = (((hi >> px) & 1) << 1) | ((lo >> px) & 1);
+			bgAttr[i] = attr;
+		}
+	}
+	if (src.color)
+	{
+		for (int i = 0; i < SCREEN_WIDTH; i++)
+			line[i] = src.bgRgb[(bgAttr[i] & 0x07) * 4 + bgColor[i]];
+	}
+	else
+	{
+		for (int i = 0; i < SCREEN_WIDTH; i++)
+			line[i] = dmg[0][bgColor[i]];
+	}
+
+	// Objects
+	if ((state.lcdc & 0x02) == 0)
+		return ;
+	height = (state.lcdc & 0x04) ? 16 : 8;
+	if (src.sprites->dirty || src.sprites->height != height || src.sprites->color != src.color)
+		buildSpriteIndex(*src.sprites, src.oam, height, src.color);
+	count = src.sprites->count[state.ly];
+	visible = src.sprites->list[state.ly];
+	std::memset(objDone, 0, sizeof(objDone));
+	for (int i = 0; i < count; i++)
+	{
+		uint8_t const*	obj = src.oam + visible[i] * 4;
+		uint32_t const*	palette;
+
+		attr = obj[3];
+		if (src.color)
+			palette = src.objRgb + (attr & 0x07) * 4;
+		else
+			palette = dmg[(attr & 0x10) ? 2 : 1];
+		y = state.ly - (obj[0] - 16);
+		if (attr & 0x40)					// Y flip
+			y = height - 1 - y;
+		tile = ((height == 16) ? (obj[2] & 0xFE) : obj[2]) * 16 + y * 2;
+		if (src.color && (attr & 0x08))		// tile in VRAM bank 1
+			tile += VRAM_BANK_SIZE;
+		lo = src.vram[tile];
+		hi = src.vram[tile + 1];
+		for (int j = 0; j < 8; j++)
+		{
+			int		sx = obj[1] - 8 + j;
+
+			if (sx < 0 || sx >= SCREEN_WIDTH || objDone[sx])
+				continue ;
+			px = (attr & 0x20) ? j : 7 - j;	// X flip
+			color = (((hi >> px) & 1) << 1) | ((lo >> px) & 1);
+			if (color == 0)
+				continue ;
+			objDone[sx] = true;
+			if (bgColor[sx] != 0 && ((attr | bgAttr[sx]) & 0x80)
+					&& (src.color == false || (state.lcdc & 0x01)))	// behind BG colors 1-3
+				continue ;
+			line[sx] = palette[color];
+		}
+	}
+}
+
+/**
+ * Build the visible OBJ list of every line
+ * Called by renderLine when OAM or the OBJ size changed
+ *
+ * @param index - index to fill
+ * @param oam - OAM_SIZE bytes mapped from 0xFE00
+ * @param height - OBJ height ( 8 or 16 )
+ * @param color - CGB priority ( OAM order only )
+ */
+void Gbmu::Ppu::buildSpriteIndex (SpriteIndex& index, uint8_t const* oam, uint8_t const& height, bool const& color)
+{
+	int			top;
+	uint8_t*	list;
+
+	std::memset(index.count, 0, sizeof(index.count));
+	for (int i = 0; i < 40; i++)				// OAM order, so the 10 first OBJ of a line are kept
+	{
+		top = oam[i * 4] - 16;
+		for (int ly = std::max(top, 0); ly < top + height && ly < VISIBLE_LINES; ly++)
+		{
+			if (index.count[ly] < 10)
+				index.list[ly][index.count[ly]++] = i;
+		}
+	}
+	for (int ly = 0; ly < VISIBLE_LINES && color == false; ly++)	// DMG: lowest X wins, then lowest OAM index
+	{
+		list = index.list[ly];
+		for (int i = 1; i < index.count[ly]; i++)
+		{
+			for (int j = i; j > 0 && oam[list[j] * 4 + 1] < oam[list[j - 1] * 4 + 1]; j--)
+				std::swap(list[j], list[j - 1]);
+		}
+	}
+	index.height = height;
+	index.color = color;
+	index.dirty = false;
+}
+
+/*
+** Private
+*/
+
+/*
+** Capture the line registers and render it ( inline ) or log it ( threaded )
+*/
+void Gbmu::Ppu::_drawLine (void)
+{
+	uint8_t const*	io = _cpu->memory()->data();
+	LogEntry		entry;
+	LineState&		state = entry.line;
+
+	state.lcdc = io[IO_LCDC];
+	state.scy = io[IO_SCY];
+	state.scx = io[IO_SCX];
+	state.wy = io[IO_WY];
+	state.wx = io[IO_WX];
+	state.bgp = io[IO_BGP];
+	state.obp0 = io[IO_OBP0];
+	state.obp1 = io[IO_OBP1];
+	state.ly = _state->ly;
+	state.windowLine = _state->windowLine;
+	if ((state.lcdc & 0x20) && (_state->color || (state.lcdc & 0x01))	// drawn, as in renderLine
+			&& _state->ly >= state.wy && state.wx <= 166)
+		_state->windowLine++;
+	if (_threaded)
+	{
+		entry.type = LOG_LINE;
+		this->_post(entry);
+	}
+	else
+	{
+		Source		src = { _cpu->memory()->vram(), io + OAM_ADDR,
+			_cpu->memory()->bcpRgb(), _cpu->memory()->ocpRgb(), _state->color, &_sprites };
+
+		renderLine(state, src, _pixels + _state->ly * SCREEN_WIDTH);
+	}
+}
+
+/*
+** Scheduler event: the current mode is over
+** Lines are drawn when they reach mode 3, the frame is completed on vblank
+*/
+void Gbmu::Ppu::_onEvent (void *owner, uint64_t const& when)
+{
+	Ppu*		ppu = static_cast<Ppu*>(owner);
+	Scheduler*	scheduler = ppu->_cpu->scheduler();
+
+	switch (ppu->_state->mode)
+	{
+		case 2:
+			ppu->_setMode(3);
+			ppu->_drawLine();
+			scheduler->schedule(Scheduler::PPU, ppu->_state->lineStart + OAM_CYCLES + TRANSFER_CYCLES);
+			break;
+		case 3:
+			ppu->_setMode(0);
+			scheduler->schedule(Scheduler::PPU, ppu->_state->lineStart + LINE_CYCLES);
+			break;
+		default:
+			ppu->_state->lineStart = when;
+			ppu->_nextLine();
+			if (ppu->_state->ly < VISIBLE_LINES)
+			{
+				ppu->_setMode(2);
+				scheduler->schedule(Scheduler::PPU, when + OAM_CYCLES);
+			}
+			else
+			{
+				ppu->_setMode(1);
+				scheduler->schedule(Scheduler::PPU, when + LINE_CYCLES);
+			}
+	}
+}
+
+void Gbmu::Ppu::_nextLine (void)
+{
+	uint8_t		*io = _cpu->memory()->data();
+
+	_state->ly++;
+	if (_state->ly == VISIBLE_LINES)
+	{
+		this->_endFrame();
+		_cpu->interrupts()->request(Interrupts::VBLANK);
+	}
+	else if (_state->ly == FRAME_LINES)
+	{
+		_state->ly = 0;
+		_state->windowLine = 0;
+	}
+	io[IO_LY] = _state->ly;
+	if (_state->ly == io[IO_LYC])					// coincidence flag, STAT interrupt if selected
+	{
+		io[IO_STAT] |= 0x04;
+		if (io[IO_STAT] & 0x40)
+			_cpu->interrupts()->request(Interrupts::LCD_STAT);
+	}
+	else
+		io[IO_STAT] &= ~0x04;
+}
+
+void Gbmu::Ppu::_endFrame (void)
+{
+	LogEntry	entry;
+
+	_state->frame++;
+	if (_threaded)
+	{
+		entry.type = LOG_FRAME;
+		this->_post(entry);
+	}
+	else
+		this->_frameRendered(_state->frame);
+}
+
+/*
+** A frame is fully rendered ( cpu thread or render thread )
+*/
+void Gbmu::Ppu::_frameRendered (uint64_t const& frame)
+{
+	if (_hashLog)
+		_hashLog->append(HashLog::hash(_pixels, SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint32_t)));
+	if (_screen)
+		_screen->onFrame(_pixels, frame);
+}
+
+/*
+** Enter a STAT mode, STAT interrupt if that mode is selected ( bits 3-5 )
+*/
+void Gbmu::Ppu::_setMode (uint8_t const& mode)
+{
+	static const uint8_t	sources[4] = { 0x08, 0x10, 0x20, 0x00 };
+	uint8_t					*stat = _cpu->memory()->data() + IO_STAT;
+
+	if (mode != _state->mode && (*stat & sources[mode]))
+		_cpu->interrupts()->request(Interrupts::LCD_STAT);
+	_state->mode = mode;
+	*stat = (*stat & ~0x03) | mode;
+}
+
+/*
+** Push an entry in the log, wait for the render thread if the log is full.
+** A sleeping render thread is woken once per frame, or when the log fills up
+*/
+void Gbmu::Ppu::_post (LogEntry const& entry)
+{
+	while (_log->push(entry) == false)
+		this->_wait(&Ppu::_hasRoom);
+	if (entry.type < LOG_FRAME && (entry.type < LOG_LINE || _log->size() < PPU_LOG_WAKE))
+		return ;
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_idle.load(std::memory_order_relaxed))
+	{
+		std::lock_guard<std::mutex>		guard(_lock);
+
+		_work.notify_one();
+	}
+}
+
+/*
+** The render thread copy of the memory, while it is stopped or sleeps on an empty log
+*/
+void Gbmu::Ppu::_copyMemory (void)
+{
+	Memory		*memory = _cpu->memory();
+
+	std::memcpy(_threadVram, memory->vram(), VRAM_SIZE);
+	std::memcpy(_threadOam, memory->data() + OAM_ADDR, OAM_SIZE);
+	std::memcpy(_threadBcp, memory->bcp(), BCP_SIZE);
+	std::memcpy(_threadBcp + BCP_SIZE, memory->ocp(), OCP_SIZE);
+	std::memcpy(_threadRgb, memory->bcpRgb(), PALETTE_COLORS * sizeof(uint32_t));
+	std::memcpy(_threadRgb + PALETTE_COLORS, memory->ocpRgb(), PALETTE_COLORS * sizeof(uint32_t));
+	_threadSprites.dirty = true;
+}
+
+/*
+** Cpu thread: sleep until done, the render thread is woken first in case
+** it sleeps with writes left in the log
+*/
+void Gbmu::Ppu::_wait (bool (Ppu::*done)(void) const)
+{
+	std::unique_lock<std::mutex>	guard(_lock);
+
+	_waiting.store(true, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	while ((this->*done)() == false)
+	{
+		_work.notify_one();
+		_progress.wait(guard);
+	}
+	_waiting.store(false, std::memory_order_relaxed);
+}
+
+/*
+** Render thread: wake the cpu thread if it waits
+*/
+void Gbmu::Ppu::_notify (void)
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_waiting.load(std::memory_order_relaxed))
+	{
+		std::lock_guard<std::mutex>		guard(_lock);
+
+		_progress.notify_all();
+	}
+}
+
+bool Gbmu::Ppu::_hasRoom (void) const
+{
+	return (_log->size() < _log->capacity());
+}
+
+bool Gbmu::Ppu::_caughtUp (void) const
+{
+	return (_framesRendered.load(std::memory_order_acquire) == _state->frame);
+}
+
+/*
+** _idle is set under _lock, held here too: the pixels drawn are visible
+*/
+bool Gbmu::Ppu::_drained (void) const
+{
+	return (_log->empty() && _idle.load(std::memory_order_relaxed));
+}
+
+/*
+** Render thread main loop
+*/
+void Gbmu::Ppu::_renderLoop (void)
+{
+	LogEntry	entry;
+	uint64_t	frame;
+	uint8_t*	palette;
+	Source		src = { _threadVram, _threadOam, _threadRgb, _threadRgb + PALETTE_COLORS,
+		_threadColor, &_threadSprites };
+
+	frame = _framesRendered.load();
+	while (true)
+	{
+		if (_log->pop(entry) == false)
+		{
+			std::unique_lock<std::mutex>	guard(_lock);
+
+			_idle.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			_progress.notify_all();			// drained
+			while (_log->empty())
+				_work.wait(guard);
+			_idle.store(false, std::memory_order_relaxed);
+			frame = _framesRendered.load(std::memory_order_relaxed);	// a restore may have set it
+			continue ;
+		}
+		switch (entry.type)
+		{
+			case LOG_VRAM:
+				_threadVram[entry.addr] = entry.value;
+				break;
+			case LOG_OAM:
+				_threadOam[entry.addr - OAM_ADDR] = entry.value;
+				_threadSprites.dirty = true;
+				break;
+			case LOG_BCP:
+			case LOG_OCP:
+				palette = _threadBcp + (entry.type == LOG_OCP ? BCP_SIZE : 0);
+				palette[entry.addr] = entry.value;
+				_threadRgb[(entry.type == LOG_OCP ? PALETTE_COLORS : 0) + (entry.addr >> 1)] =
+					Memory::rgb555ToArgb(palette[entry.addr & 0x3E], palette[entry.addr | 0x01]);
+				break;
+			case LOG_LINE:
+				renderLine(entry.line, src, _pixels + entry.line.ly * SCREEN_WIDTH);
+				break;
+			case LOG_FRAME:
+				frame++;
+				this->_frameRendered(frame);
+				_framesRendered.store(frame, std::memory_order_release);
+				this->_notify();
+				break;
+			case LOG_STOP:
+				return ;
+		}
+	}
+}
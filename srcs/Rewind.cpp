@@ -0,0 +1,307 @@
+#include "../includes/Rewind.class.hpp"
+#include <cstring>
+
+/*
+** 8 bytes of a XOR b ( b NULL is zeros )
+*/
+static inline uint64_t	xorWord (uint8_t const* a, uint8_t const* b, size_t const& i)
+{
+	uint64_t	x, y;
+
+	std::memcpy(&x, a + i, 8);
+	if (b == NULL)
+		return (x);
+	std::memcpy(&y, b + i, 8);
+	return (x ^ y);
+}
+
+static inline size_t	putVarint (uint8_t *out, size_t value)
+{
+	size_t		size = 0;
+
+	while (value >= 0x80)
+	{
+		out[size++] = (value & 0x7F) | 0x80;
+		value >>= 7;
+	}
+	out[size++] = value;
+	return (size);
+}
+
+static inline size_t	getVarint (uint8_t const* in, size_t& pos)
+{
+	size_t		value = 0;
+	int			shift = 0;
+
+	while (in[pos] & 0x80)
+	{
+		value |= static_cast<size_t>(in[pos++] & 0x7F) << shift;
+		shift += 7;
+	}
+	return (value | (static_cast<size_t>(in[pos++]) << shift));
+}
+
+Gbmu::Rewind::Rewind (size_t const& memory) :
+	_ring(new uint8_t[memory]),
+	_capacity(memory),
+	_entries(new Entry[REWIND_ENTRIES]),
+	_state(NULL),
+	_stateSize(0),
+	_scratch(NULL),
+	_packed(NULL),
+	_pack(StateCodec::available(StateCodec::LZ4))
+{
+	this->clear();
+}
+
+Gbmu::Rewind::~Rewind (void)
+{
+	delete[] _ring;
+	delete[] _entries;
+	delete[] _state;
+	delete[] _scratch;
+	delete[] _packed;
+}
+
+void Gbmu::Rewind::clear (void)
+{
+	_first = 0;
+	_count = 0;
+	_used = 0;
+	_sinceKeyframe = 0;
+}
+
+/*
+** Store state as the newest capture
+*/
+void Gbmu::Rewind::push (SaveState const& state)
+{
+	bool		keyframe;
+	size_t		size;
+
+	if (state.size() != _stateSize)		// another layout, start over
+	{
+		this->_resize(state.size());
+		this->clear();
+	}
+	keyframe = _count == 0 || _sinceKeyframe >= REWIND_KEYFRAME;
+	size = _encode(state.data(), keyframe ? NULL : _state, _stateSize, _scratch);
+	if (this->_store(size, keyframe) == false)		// its chain was dropped for room
+	{
+		keyframe = true;
+		size = _encode(state.data(), NULL, _stateSize, _scratch);
+		this->_store(size, keyframe);
+	}
+	std::memcpy(_state, state.data(), _stateSize);
+	_sinceKeyframe = keyframe ? 1 : _sinceKeyframe + 1;
+}
+
+/*
+** The newest delta turns the newest state into the one before,
+** a keyframe has no previous state in it: that one comes from its chain
+*/
+bool Gbmu::Rewind::back (SaveState& state)
+{
+	Entry		newest;
+
+	if (_count < 2)
+		return (false);
+	newest = this->_entry(0);
+	_count--;
+	_used -= newest.size;
+	if (newest.keyframe)
+	{
+		if (this->at(0, state) == false)
+			return (false);
+		std::memcpy(_state, state.data(), _stateSize);
+	}
+	else
+	{
+		this->_apply(newest, _state);
+		state.assign(_state, _stateSize);
+	}
+	_sinceKeyframe = 0;
+	while (_sinceKeyframe < _count && this->_entry(_sinceKeyframe).keyframe == false)
+		_sinceKeyframe++;
+	_sinceKeyframe++;
+	return (true);
+}
+
+/*
+** Rebuild the capture of age from the keyframe of its chain
+*/
+bool Gbmu::Rewind::at (size_t const& age, SaveState& state)
+{
+	size_t		keyframe = age;
+
+	if (age >= _count)
+		return (false);
+	while (keyframe < _count && this->_entry(keyframe).keyframe == false)
+		keyframe++;
+	if (keyframe == _count)
+		return (false);
+	std::memset(_scratch, 0, _stateSize);
+	for (size_t i = keyframe + 1; i-- > age; )
+		this->_apply(this->_entry(i), _scratch);
+	return (state.assign(_scratch, _stateSize));
+}
+
+size_t const& Gbmu::Rewind::count (void) const
+{
+	return (_count);
+}
+
+size_t const& Gbmu::Rewind::used (void) const
+{
+	return (_used);
+}
+
+/*
+** Private
+*/
+
+Gbmu::Rewind::Entry& Gbmu::Rewind::_entry (size_t const& age)
+{
+	return (_entries[(_first + _count - 1 - age) % REWIND_ENTRIES]);
+}
+
+/*
+** Drop the oldest chain, its deltas are useless without the keyframe
+*/
+void Gbmu::Rewind::_dropOldest (void)
+{
+	do
+	{
+		_used -= _entries[_first].size;
+		_first = (_first + 1) % REWIND_ENTRIES;
+		_count--;
+	}
+	while (_count > 0 && _entries[_first].keyframe == false);
+}
+
+bool Gbmu::Rewind::_overlaps (size_t const& offset, size_t const& size)
+{
+	Entry*		entry;
+
+	for (size_t i = 0; i < _count; i++)
+	{
+		entry = _entries + (_first + i) % REWIND_ENTRIES;
+		if (entry->offset < offset + size && offset < entry->offset + entry->size)
+			return (true);
+	}
+	return (false);
+}
+
+/*
+** Copy the coded scratch ( packed if smaller ) after the newest entry, or
+** at the ring start. Return false when a delta lost its own chain
+*/
+bool Gbmu::Rewind::_store (size_t const& coded, bool const& keyframe)
+{
+	uint8_t const*	data = _scratch;
+	size_t			size = coded;
+	size_t			raw = 0;
+	size_t			offset = 0;
+	size_t			packed;
+	Entry*			entry;
+
+	if (_pack && (packed = StateCodec::pack(StateCodec::LZ4, _scratch, coded, _packed, _stateSize * 2 + 64)) > 0
+		&& packed < coded)
+	{
+		data = _packed;
+		size = packed;
+		raw = coded;
+	}
+	if (size > _capacity)
+	{
+		this->clear();
+		return (true);
+	}
+	if (_count > 0)
+		offset = this->_entry(0).offset + this->_entry(0).size;
+	if (offset + size > _capacity)
+		offset = 0;
+	while (_count > 0 && (_count == REWIND_ENTRIES || this->_overlaps(offset, size)))
+		this->_dropOldest();
+	if (_count == 0 && keyframe == false)
+		return (false);
+	std::memcpy(_ring + offset, data, size);
+	entry = _entries + (_first + _count) % REWIND_ENTRIES;
+	entry->offset = offset;
+	entry->size = size;
+	entry->raw = raw;
+	entry->keyframe = keyframe;
+	_count++;
+	_used += size;
+	return (true);
+}
+
+void Gbmu::Rewind::_resize (size_t const& size)
+{
+	delete[] _state;
+	delete[] _scratch;
+	delete[] _packed;
+	_stateSize = size;
+	_state = new uint8_t[size]();
+	_scratch = new uint8_t[size * 2 + 64];	// worst case coding
+	_packed = new uint8_t[size * 2 + 64];
+}
+
+/*
+** state ^= the entry, unpacked first if it has to
+*/
+void Gbmu::Rewind::_apply (Entry const& entry, uint8_t* state)
+{
+	if (entry.raw == 0)
+		_apply(_ring + entry.offset, entry.size, state);
+	else if (StateCodec::unpack(StateCodec::LZ4, _ring + entry.offset, entry.size, _packed, entry.raw))
+		_apply(_packed, entry.raw, state);
+}
+
+/*
+** Run length code a XOR b: zero runs are skipped 8 bytes at a time,
+** a literal run ends on 8 zero bytes
+*/
+size_t Gbmu::Rewind::_encode (uint8_t const* a, uint8_t const* b, size_t const& size, uint8_t* out)
+{
+	size_t		i = 0;
+	size_t		o = 0;
+	size_t		start, literal;
+
+	while (i < size)
+	{
+		start = i;
+		while (i + 8 <= size && xorWord(a, b, i) == 0)
+			i += 8;
+		while (i < size && (a[i] ^ (b ? b[i] : 0)) == 0)
+			i++;
+		literal = i;
+		while (i < size && !(i + 8 <= size && xorWord(a, b, i) == 0))
+			i += (i + 8 <= size) ? 8 : 1;
+		o += putVarint(out + o, literal - start);
+		o += putVarint(out + o, i - literal);
+		for (size_t k = literal; k < i; k++)
+			out[o++] = a[k] ^ (b ? b[k] : 0);
+	}
+	return (o);
+}
+
+/*
+** state ^= decoded bytes
+*/
+void Gbmu::Rewind::_apply (uint8_t const* in, size_t const& size, uint8_t* state)
+{
+	size_t		p = 0;
+	size_t		pos = 0;
+	size_t		literal;
+
+	while (p < size)
+	{
+		pos += getVarint(in, p);
+		literal = getVarint(in, p);
+		for (size_t k = 0; k < literal; k++)
+			state[pos + k] ^= in[p + k];
+		p += literal;
+		pos += literal;
+	}
+}
@@ -0,0 +1,233 @@
+#include "../includes/SaveState.class.hpp"
+#include <cstring>
+#include <cstdio>
+
+/*
+** Chunk header: tag, version, reserved, payload size
+*/
+struct ChunkHeader
+{
+	char		tag[4];
+	uint16_t	version;
+	uint16_t	reserved;
+	uint32_t	size;
+};
+
+Gbmu::SaveState::SaveState (size_t const& capacity) :
+	_buffer(new uint8_t[capacity]),
+	_capacity(capacity),
+	_size(0),
+	_chunk(0),
+	_pos(0),
+	_end(0),
+	_version(0)
+{
+	this->clear();
+}
+
+Gbmu::SaveState::~SaveState (void)
+{
+	delete[] _buffer;
+}
+
+/*
+** Writing
+*/
+
+void Gbmu::SaveState::clear (void)
+{
+	ChunkHeader		header;
+
+	std::memcpy(header.tag, SAVESTATE_MAGIC, 4);
+	header.version = SAVESTATE_FORMAT;
+	header.reserved = 0;
+	header.size = 0;
+	_size = 0;
+	this->write(&header, sizeof(header));
+	this->end();
+}
+
+void Gbmu::SaveState::begin (char const* tag, uint16_t const& version)
+{
+	ChunkHeader		header;
+
+	std::memcpy(header.tag, tag, 4);
+	header.version = version;
+	header.reserved = 0;
+	header.size = 0;
+	_chunk = _size;
+	this->write(&header, sizeof(header));
+}
+
+void Gbmu::SaveState::write (void const* data, size_t const& size)
+{
+	this->_reserve(_size + size);
+	std::memcpy(_buffer + _size, data, size);
+	_size += size;
+}
+
+/*
+** Patch the open chunk size, or the whole state size in the file header
+*/
+void Gbmu::SaveState::end (void)
+{
+	uint32_t		total = _size - SAVESTATE_HEADER_SIZE;
+	uint32_t		size = _size - _chunk - SAVESTATE_HEADER_SIZE;
+
+	std::memcpy(_buffer + 8, &total, 4);
+	if (_chunk > 0)
+		std::memcpy(_buffer + _chunk + 8, &size, 4);
+	_chunk = 0;
+}
+
+bool Gbmu::SaveState::save (std::string const& path) const
+{
+	FILE*		file;
+	bool		ok;
+
+	if ((file = fopen(path.c_str(), "wb")) == NULL)
+		return (false);
+	ok = fwrite(_buffer, 1, _size, file) == _size;
+	return (fclose(file) == 0 && ok);
+}
+
+/*
+** Reading
+*/
+
+bool Gbmu::SaveState::load (std::string const& path)
+{
+	FILE*		file;
+	long		size;
+	bool		ok;
+
+	if ((file = fopen(path.c_str(), "rb")) == NULL)
+		return (false);
+	ok = fseek(file, 0, SEEK_END) == 0 && (size = ftell(file)) >= SAVESTATE_HEADER_SIZE
+		&& fseek(file, 0, SEEK_SET) == 0;
+	if (ok)
+	{
+		this->_reserve(size);
+		_size = size;
+		ok = fread(_buffer, 1, _size, file) == _size;
+	}
+	fclose(file);
+	if (ok == false || this->_check() == false)
+	{
+		this->clear();
+		return (false);
+	}
+	return (true);
+}
+
+/*
+** Copy a state from memory
+*/
+bool Gbmu::SaveState::assign (uint8_t const* data, size_t const& size)
+{
+	this->_reserve(size);
+	std::memcpy(_buffer, data, size);
+	_size = size;
+	if (size < SAVESTATE_HEADER_SIZE || this->_check() == false)
+	{
+		this->clear();
+		return (false);
+	}
+	return (true);
+}
+
+/*
+** Go to the payload of the chunk tag
+*/
+bool Gbmu::SaveState::find (char const* tag)
+{
+	ChunkHeader		header;
+	size_t			pos = SAVESTATE_HEADER_SIZE;
+
+	while (pos + SAVESTATE_HEADER_SIZE <= _size)
+	{
+		std::memcpy(&header, _buffer + pos, sizeof(header));
+		pos += SAVESTATE_HEADER_SIZE;
+		if (header.size > _size - pos)
+			break ;
+		if (std::memcmp(header.tag, tag, 4) == 0)
+		{
+			_pos = pos;
+			_end = pos + header.size;
+			_version = header.version;
+			return (true);
+		}
+		pos += header.size;
+	}
+	_pos = 0;
+	_end = 0;
+	return (false);
+}
+
+uint16_t const& Gbmu::SaveState::version (void) const
+{
+	return (_version);
+}
+
+bool Gbmu::SaveState::read (void* data, size_t const& size)
+{
+	if (size > _end - _pos)
+		return (false);
+	std::memcpy(data, _buffer + _pos, size);
+	_pos += size;
+	return (true);
+}
+
+bool Gbmu::SaveState::skip (size_t const& size)
+{
+	if (size > _end - _pos)
+		return (false);
+	_pos += size;
+	return (true);
+}
+
+size_t Gbmu::SaveState::remaining (void) const
+{
+	return (_end - _pos);
+}
+
+uint8_t const* Gbmu::SaveState::data (void) const
+{
+	return (_buffer);
+}
+
+size_t const& Gbmu::SaveState::size (void) const
+{
+	return (_size);
+}
+
+/*
+** Private
+*/
+
+void Gbmu::SaveState::_reserve (size_t const& size)
+{
+	uint8_t*	buffer;
+
+	if (size <= _capacity)
+		return ;
+	while (_capacity < size)
+		_capacity *= 2;
+	buffer = new uint8_t[_capacity];
+	std::memcpy(buffer, _buffer, _size);
+	delete[] _buffer;
+	_buffer = buffer;
+}
+
+/*
+** File header: magic, a known format and the right size
+*/
+bool Gbmu::SaveState::_check (void) const
+{
+	ChunkHeader		header;
+
+	std::memcpy(&header, _buffer, sizeof(header));
+	return (std::memcmp(header.tag, SAVESTATE_MAGIC, 4) == 0
+		&& header.version <= SAVESTATE_FORMAT
+		&& header.size == _size - SAVESTATE_HEADER_SIZE);
+}
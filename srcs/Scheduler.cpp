@@ -0,0 +1,146 @@
+#include "../includes/Scheduler.class.hpp"
+#include <new>
+
+Gbmu::Scheduler::Scheduler (StateArena *arena) :
+	_state(new (arena->at<void>(ARENA_SCHEDULER)) State)
+{
+	static_assert(sizeof(State) <= ARENA_APU - ARENA_SCHEDULER, "the scheduler overlaps the apu");
+	for (int i = 0; i < EVENT_COUNT; i++)
+	{
+		_handlers[i] = NULL;
+		_owners[i] = NULL;
+	}
+	this->reset();
+}
+
+Gbmu::Scheduler::~Scheduler (void) {}
+
+/*
+** Back to cycle 0 without any pending event ( handlers are kept )
+*/
+void Gbmu::Scheduler::reset (void)
+{
+	_state->now = 0;
+	_state->deadline = NO_DEADLINE;
+	_state->size = 0;
+	for (int i = 0; i < EVENT_COUNT; i++)
+		_state->pos[i] = -1;
+}
+
+void Gbmu::Scheduler::setHandler (Event const& event, Handler handler, void *owner)
+{
+	_handlers[event] = handler;
+	_owners[event] = owner;
+}
+
+/*
+** Schedule event at the absolute cycle when, replace the pending one if any
+*/
+void Gbmu::Scheduler::schedule (Event const& event, uint64_t const& when)
+{
+	int		i = _state->pos[event];
+
+	if (i < 0)
+	{
+		i = _state->size++;
+		_state->heap[i].event = event;
+		_state->pos[event] = i;
+		_state->heap[i].when = when;
+		this->_up(i);
+	}
+	else if (when < _state->heap[i].when)
+	{
+		_state->heap[i].when = when;
+		this->_up(i);
+	}
+	else
+	{
+		_state->heap[i].when = when;
+		this->_down(i);
+	}
+	_state->deadline = _state->heap[0].when;
+}
+
+void Gbmu::Scheduler::cancel (Event const& event)
+{
+	if (_state->pos[event] < 0)
+		return ;
+	this->_remove(_state->pos[event]);
+	_state->deadline = _state->size ? _state->heap[0].when : NO_DEADLINE;
+}
+
+bool Gbmu::Scheduler::pending (Event const& event) const
+{
+	return (_state->pos[event] >= 0);
+}
+
+uint64_t Gbmu::Scheduler::when (Event const& event) const
+{
+	return (_state->pos[event] >= 0 ? _state->heap[_state->pos[event]].when : NO_DEADLINE);
+}
+
+/*
+** Run every event due at now, in time order
+** A handler may schedule again its own event ( or any other )
+*/
+void Gbmu::Scheduler::dispatch (void)
+{
+	Entry	entry;
+
+	while (_state->size && _state->heap[0].when <= _state->now)
+	{
+		entry = _state->heap[0];
+		this->_remove(0);
+		_state->deadline = _state->size ? _state->heap[0].when : NO_DEADLINE;
+		_handlers[entry.event](_owners[entry.event], entry.when);
+	}
+}
+
+/*
+** Private
+*/
+
+void Gbmu::Scheduler::_swap (int const& a, int const& b)
+{
+	Entry	tmp = _state->heap[a];
+
+	_state->heap[a] = _state->heap[b];
+	_state->heap[b] = tmp;
+	_state->pos[_state->heap[a].event] = a;
+	_state->pos[_state->heap[b].event] = b;
+}
+
+void Gbmu::Scheduler::_up (int i)
+{
+	while (i > 0 && _state->heap[i].when < _state->heap[(i - 1) / 2].when)
+	{
+		this->_swap(i, (i - 1) / 2);
+		i = (i - 1) / 2;
+	}
+}
+
+void Gbmu::Scheduler::_down (int i)
+{
+	int		child;
+
+	while ((child = i * 2 + 1) < _state->size)
+	{
+		if (child + 1 < _state->size && _state->heap[child + 1].when < _state->heap[child].when)
+			child++;
+		if (_state->heap[i].when <= _state->heap[child].when)
+			break ;
+		this->_swap(i, child);
+		i = child;
+	}
+}
+
+void Gbmu::Scheduler::_remove (int const& i)
+{
+	_state->pos[_state->heap[i].event] = -1;
+	if (i == --_state->size)
+		return ;
+	_state->heap[i] = _state->heap[_state->size];
+	_state->pos[_state->heap[i].event] = i;
+	this->_down(i);
+	this->_up(i);
+}
@@ -0,0 +1,76 @@
+#include "../includes/StateArena.class.hpp"
+#include <cstdlib>
+#include <new>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*
+** Anonymous pages are zeroed, and never committed when never written
+*/
+Gbmu::StateArena::StateArena (void)
+{
+	void	*base;
+
+	base = mmap(NULL, ARENA_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+	if (base == MAP_FAILED)
+		throw std::bad_alloc();
+	_base = static_cast<uint8_t*>(base);
+}
+
+Gbmu::StateArena::~StateArena (void)
+{
+	munmap(_base, ARENA_SIZE);
+}
+
+uint8_t* Gbmu::StateArena::base (void) const
+{
+	return (_base);
+}
+
+/*
+** One write, one read of the live range
+*/
+void Gbmu::StateArena::saveState (SaveState& state) const
+{
+	state.begin("ARNA", 1);
+	state.write(_base + ARENA_LIVE, ARENA_SIZE - ARENA_LIVE);
+	state.end();
+}
+
+/*
+** Another layout is another machine, nothing is read from it
+*/
+bool Gbmu::StateArena::loadState (SaveState& state)
+{
+	return (state.find("ARNA") && state.version() == 1
+		&& state.read(_base + ARENA_LIVE, ARENA_SIZE - ARENA_LIVE));
+}
+
+/*
+** The file is gone once the last arena mapping it is
+*/
+int Gbmu::StateArena::share (void) const
+{
+	char		path[] = "/tmp/gbmu-arena-XXXXXX";
+	int			fd;
+
+	if ((fd = mkstemp(path)) < 0)
+		return (-1);
+	unlink(path);
+	if (write(fd, _base, ARENA_SIZE) != ARENA_SIZE)
+	{
+		close(fd);
+		return (-1);
+	}
+	return (fd);
+}
+
+/*
+** Same address, so the objects placed in the arena stay where they are
+*/
+bool Gbmu::StateArena::attach (int const& fd)
+{
+	if (ARENA_SIZE % sysconf(_SC_PAGESIZE) != 0)
+		return (false);
+	return (mmap(_base, ARENA_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) != MAP_FAILED);
+}
@@ -0,0 +1,529 @@
+#include "../includes/StateCodec.class.hpp"
+#include <cstring>
+#include <cstdio>
+#include <vector>
+#include <algorithm>
+#ifdef GBMU_ZLIB
+# include <zlib.h>
+#endif
+#ifdef GBMU_LZ4
+# include <lz4frame.h>
+#endif
+#ifdef GBMU_ZSTD
+# include <zstd.h>
+#endif
+
+#define LZ4_SLICE		0x4000		// input given to LZ4F_compressUpdate at once
+
+/*
+** Payload of the PACK chunk, before the compressed bytes
+*/
+struct PackHeader
+{
+	uint16_t	codec;
+	uint16_t	reserved;
+	uint32_t	raw;		// bytes once decompressed
+};
+
+/*
+** Chunk header, as written by SaveState
+*/
+struct ChunkHeader
+{
+	char		tag[4];
+	uint16_t	version;
+	uint16_t	reserved;
+	uint32_t	size;
+};
+
+/*
+** One compression stream to a file, fed chunk by chunk
+*/
+class Packer
+{
+	private:
+		FILE*					_file;
+		Gbmu::StateCodec::Codec	_codec;
+		std::vector<uint8_t>	_out;
+		size_t					_written;	// compressed bytes
+		bool					_ok;
+#ifdef GBMU_ZLIB
+		z_stream				_zlib;
+#endif
+#ifdef GBMU_LZ4
+		LZ4F_cctx*				_lz4;
+		LZ4F_preferences_t		_prefs;
+#endif
+#ifdef GBMU_ZSTD
+		ZSTD_CCtx*				_zstd;
+#endif
+
+		bool	_flush ( size_t const& size )
+		{
+			if (_ok && size > 0 && fwrite(&_out[0], 1, size, _file) != size)
+				_ok = false;
+			_written += size;
+			return (_ok);
+		}
+
+	public:
+		Packer (FILE *file, Gbmu::StateCodec::Codec const& codec, int const& level, size_t const& raw) :
+			_file(file),
+			_codec(codec),
+			_written(0),
+			_ok(false)
+		{
+			(void)level;
+			(void)raw;
+#ifdef GBMU_LZ4
+			_lz4 = NULL;
+#endif
+#ifdef GBMU_ZSTD
+			_zstd = NULL;
+#endif
+			switch (_codec)
+			{
+#ifdef GBMU_ZLIB
+				case Gbmu::StateCodec::ZLIB:
+					std::memset(&_zlib, 0, sizeof(_zlib));
+					_out.resize(STATECODEC_BLOCK);
+					_ok = deflateInit(&_zlib, level ? level : Z_DEFAULT_COMPRESSION) == Z_OK;
+					break ;
+#endif
+#ifdef GBMU_LZ4
+				case Gbmu::StateCodec::LZ4:
+				{
+					size_t	begin;
+
+					std::memset(&_prefs, 0, sizeof(_prefs));
+					_prefs.compressionLevel = level;
+					_prefs.frameInfo.contentSize = raw;
+					_out.resize(LZ4F_compressBound(LZ4_SLICE, &_prefs));
+					if (LZ4F_isError(LZ4F_createCompressionContext(&_lz4, LZ4F_VERSION)))
+						break ;
+					begin = LZ4F_compressBegin(_lz4, &_out[0], _out.size(), &_prefs);
+					_ok = LZ4F_isError(begin) == 0;
+					this->_flush(begin);
+					break ;
+				}
+#endif
+#ifdef GBMU_ZSTD
+				case Gbmu::StateCodec::ZSTD:
+					_out.resize(ZSTD_CStreamOutSize());
+					if ((_zstd = ZSTD_createCCtx()) == NULL)
+						break ;
+					_ok = ZSTD_isError(ZSTD_CCtx_setParameter(_zstd, ZSTD_c_compressionLevel,
+							level ? level : ZSTD_CLEVEL_DEFAULT)) == 0
+						&& ZSTD_isError(ZSTD_CCtx_setPledgedSrcSize(_zstd, raw)) == 0;
+					break ;
+#endif
+				default:
+					break ;
+			}
+		}
+
+		~Packer (void)
+		{
+			switch (_codec)
+			{
+#ifdef GBMU_ZLIB
+				case Gbmu::StateCodec::ZLIB:
+					deflateEnd(&_zlib);
+					break ;
+#endif
+#ifdef GBMU_LZ4
+				case Gbmu::StateCodec::LZ4:
+					LZ4F_freeCompressionContext(_lz4);
+					break ;
+#endif
+#ifdef GBMU_ZSTD
+				case Gbmu::StateCodec::ZSTD:
+					ZSTD_freeCCtx(_zstd);
+					break ;
+#endif
+				default:
+					break ;
+			}
+		}
+
+		bool	update (uint8_t const* data, size_t const& size)
+		{
+			(void)data;
+			(void)size;
+			if (_ok == false)
+				return (false);
+			switch (_codec)
+			{
+#ifdef GBMU_ZLIB
+				case Gbmu::StateCodec::ZLIB:
+					_zlib.next_in = const_cast<Bytef*>(data);
+					_zlib.avail_in = size;
+					do
+					{
+						_zlib.next_out = &_out[0];
+						_zlib.avail_out = _out.size();
+						if (deflate(&_zlib, Z_NO_FLUSH) == Z_STREAM_ERROR)
+							return (_ok = false);
+						this->_flush(_out.size() - _zlib.avail_out);
+					} while (_ok && _zlib.avail_out == 0);
+					break ;
+#endif
+#ifdef GBMU_LZ4
+				case Gbmu::StateCodec::LZ4:
+					for (size_t pos = 0, n; _ok && pos < size; pos += n)
+					{
+						size_t	packed;
+
+						n = std::min(size - pos, static_cast<size_t>(LZ4_SLICE));
+						packed = LZ4F_compressUpdate(_lz4, &_out[0], _out.size(), data + pos, n, NULL);
+						if (LZ4F_isError(packed))
+							return (_ok = false);
+						this->_flush(packed);
+					}
+					break ;
+#endif
+#ifdef GBMU_ZSTD
+				case Gbmu::StateCodec::ZSTD:
+				{
+					ZSTD_inBuffer	in = { data, size, 0 };
+
+					while (_ok && in.pos < in.size)
+					{
+						ZSTD_outBuffer	out = { &_out[0], _out.size(), 0 };
+
+						if (ZSTD_isError(ZSTD_compressStream2(_zstd, &out, &in, ZSTD_e_continue)))
+							return (_ok = false);
+						this->_flush(out.pos);
+					}
+					break ;
+				}
+#endif
+				default:
+					return (_ok = false);
+			}
+			return (_ok);
+		}
+
+		bool	finish (void)
+		{
+			if (_ok == false)
+				return (false);
+			switch (_codec)
+			{
+#ifdef GBMU_ZLIB
+				case Gbmu::StateCodec::ZLIB:
+				{
+					int		status;
+
+					_zlib.avail_in = 0;
+					do
+					{
+						_zlib.next_out = &_out[0];
+						_zlib.avail_out = _out.size();
+						status = deflate(&_zlib, Z_FINISH);
+						this->_flush(_out.size() - _zlib.avail_out);
+					} while (_ok && status == Z_OK);
+					_ok = _ok && status == Z_STREAM_END;
+					break ;
+				}
+#endif
+#ifdef GBMU_LZ4
+				case Gbmu::StateCodec::LZ4:
+				{
+					size_t	packed = LZ4F_compressEnd(_lz4, &_out[0], _out.size(), NULL);
+
+					if (LZ4F_isError(packed))
+						return (_ok = false);
+					this->_flush(packed);
+					break ;
+				}
+#endif
+#ifdef GBMU_ZSTD
+				case Gbmu::StateCodec::ZSTD:
+				{
+					ZSTD_inBuffer	in = { NULL, 0, 0 };
+					size_t			left;
+
+					do
+					{
+						ZSTD_outBuffer	out = { &_out[0], _out.size(), 0 };
+
+						left = ZSTD_compressStream2(_zstd, &out, &in, ZSTD_e_end);
+						if (ZSTD_isError(left))
+							return (_ok = false);
+						this->_flush(out.pos);
+					} while (_ok && left > 0);
+					break ;
+				}
+#endif
+				default:
+					return (_ok = false);
+			}
+			return (_ok);
+		}
+
+		size_t const&	written (void) const
+		{
+			return (_written);
+		}
+};
+
+static void		saveJob (Gbmu::StateCodec::Job *job)
+{
+	job->ok = Gbmu::StateCodec::save(*job->state, job->path, job->codec, job->level);
+}
+
+bool Gbmu::StateCodec::available (Codec const& codec)
+{
+	switch (codec)
+	{
+		case NONE:
+			return (true);
+#ifdef GBMU_ZLIB
+		case ZLIB:
+			return (true);
+#endif
+#ifdef GBMU_LZ4
+		case LZ4:
+			return (true);
+#endif
+#ifdef GBMU_ZSTD
+		case ZSTD:
+			return (true);
+#endif
+		default:
+			return (false);
+	}
+}
+
+/*
+** Whole buffer at once, one frame of the codec
+*/
+size_t Gbmu::StateCodec::pack (Codec const& codec, uint8_t const* src, size_t const& size,
+	uint8_t* dst, size_t const& capacity, int const& level)
+{
+	(void)src;
+	(void)size;
+	(void)dst;
+	(void)capacity;
+	(void)level;
+	switch (codec)
+	{
+#ifdef GBMU_ZLIB
+		case ZLIB:
+		{
+			uLongf	length = capacity;
+
+			return (compress2(dst, &length, src, size, level ? level : Z_DEFAULT_COMPRESSION) == Z_OK ? length : 0);
+		}
+#endif
+#ifdef GBMU_LZ4
+		case LZ4:
+		{
+			LZ4F_preferences_t	prefs;
+			size_t				length;
+
+			std::memset(&prefs, 0, sizeof(prefs));
+			prefs.compressionLevel = level;
+			prefs.frameInfo.contentSize = size;
+			if (LZ4F_compressFrameBound(size, &prefs) > capacity)
+				return (0);
+			length = LZ4F_compressFrame(dst, capacity, src, size, &prefs);
+			return (LZ4F_isError(length) ? 0 : length);
+		}
+#endif
+#ifdef GBMU_ZSTD
+		case ZSTD:
+		{
+			size_t	length = ZSTD_compress(dst, capacity, src, size, level ? level : ZSTD_CLEVEL_DEFAULT);
+
+			return (ZSTD_isError(length) ? 0 : length);
+		}
+#endif
+		default:
+			return (0);
+	}
+}
+
+/*
+** Whole buffer at once: the raw size is known
+*/
+bool Gbmu::StateCodec::unpack (Codec const& codec, uint8_t const* src, size_t const& size,
+	uint8_t* dst, size_t const& raw)
+{
+	(void)src;
+	(void)size;
+	(void)dst;
+	(void)raw;
+	switch (codec)
+	{
+#ifdef GBMU_ZLIB
+		case ZLIB:
+		{
+			uLongf	length = raw;
+
+			return (uncompress(dst, &length, src, size) == Z_OK && length == raw);
+		}
+#endif
+#ifdef GBMU_LZ4
+		case LZ4:
+		{
+			LZ4F_dctx*	context;
+			size_t		in = 0, out = 0, status = 1;
+			size_t		srcSize, dstSize;
+
+			if (LZ4F_isError(LZ4F_createDecompressionContext(&context, LZ4F_VERSION)))
+				return (false);
+			while (status != 0 && in < size)
+			{
+				srcSize = size - in;
+				dstSize = raw - out;
+				status = LZ4F_decompress(context, dst + out, &dstSize, src + in, &srcSize, NULL);
+				if (LZ4F_isError(status) || (srcSize == 0 && dstSize == 0))
+					break ;
+				in += srcSize;
+				out += dstSize;
+			}
+			LZ4F_freeDecompressionContext(context);
+			return (status == 0 && out == raw);
+		}
+#endif
+#ifdef GBMU_ZSTD
+		case ZSTD:
+		{
+			size_t	length = ZSTD_decompress(dst, raw, src, size);
+
+			return (ZSTD_isError(length) == 0 && length == raw);
+		}
+#endif
+		default:
+			return (false);
+	}
+}
+
+char const* Gbmu::StateCodec::name (Codec const& codec)
+{
+	static char const*	names[] = { "none", "zlib", "lz4", "zstd" };
+
+	return (codec <= ZSTD ? names[codec] : "?");
+}
+
+bool Gbmu::StateCodec::parse (std::string const& name, Codec& codec)
+{
+	for (int i = NONE; i <= ZSTD; i++)
+	{
+		if (name == StateCodec::name(static_cast<Codec>(i)))
+		{
+			codec = static_cast<Codec>(i);
+			return (true);
+		}
+	}
+	return (false);
+}
+
+/*
+** Header and META as they are, then the other chunks through the codec.
+** The sizes are patched once the stream is done
+*/
+bool Gbmu::StateCodec::save (SaveState const& state, std::string const& path, Codec const& codec, int const& level)
+{
+	uint8_t const*	data = state.data();
+	size_t			pos = SAVESTATE_HEADER_SIZE;
+	size_t			head;			// bytes kept as they are
+	ChunkHeader		chunk;
+	PackHeader		pack;
+	FILE*			file;
+	bool			ok;
+	uint32_t		size;
+
+	if (codec == NONE)
+		return (state.save(path));
+	if (available(codec) == false || (file = fopen(path.c_str(), "wb")) == NULL)
+		return (false);
+	if (pos + SAVESTATE_HEADER_SIZE <= state.size())
+	{
+		std::memcpy(&chunk, data + pos, sizeof(chunk));
+		if (std::memcmp(chunk.tag, "META", 4) == 0)
+			pos += SAVESTATE_HEADER_SIZE + chunk.size;
+	}
+	head = pos;
+	std::memcpy(chunk.tag, STATECODEC_TAG, 4);
+	chunk.version = STATECODEC_VERSION;
+	chunk.reserved = 0;
+	chunk.size = 0;
+	pack.codec = codec;
+	pack.reserved = 0;
+	pack.raw = state.size() - head;
+	ok = fwrite(data, 1, head, file) == head
+		&& fwrite(&chunk, sizeof(chunk), 1, file) == 1
+		&& fwrite(&pack, sizeof(pack), 1, file) == 1;
+	if (ok)
+	{
+		Packer		packer(file, codec, level, pack.raw);
+
+		while (ok && pos + SAVESTATE_HEADER_SIZE <= state.size())
+		{
+			std::memcpy(&chunk, data + pos, sizeof(chunk));
+			ok = packer.update(data + pos, SAVESTATE_HEADER_SIZE + chunk.size);
+			pos += SAVESTATE_HEADER_SIZE + chunk.size;
+		}
+		ok = ok && packer.finish();
+		size = sizeof(pack) + packer.written();
+		ok = ok && fseek(file, head + 8, SEEK_SET) == 0
+			&& fwrite(&size, 4, 1, file) == 1;
+		size += head;		// + PACK header - file header
+		ok = ok && fseek(file, 8, SEEK_SET) == 0
+			&& fwrite(&size, 4, 1, file) == 1;
+	}
+	return (fclose(file) == 0 && ok);
+}
+
+/*
+** A packed state is rebuilt in state: file header, META and the chunks.
+** The raw size comes from the file, it is checked before the allocation
+*/
+bool Gbmu::StateCodec::load (SaveState& state, std::string const& path)
+{
+	PackHeader				pack;
+	ChunkHeader				chunk;
+	std::vector<uint8_t>	packed;
+	std::vector<uint8_t>	raw;
+	size_t					head = SAVESTATE_HEADER_SIZE;
+	uint32_t				size;
+
+	if (state.load(path) == false)
+		return (false);
+	if (state.find(STATECODEC_TAG) == false)
+		return (true);
+	if (state.get(pack) == false || available(static_cast<Codec>(pack.codec)) == false
+		|| pack.raw > STATECODEC_MAX_RAW)
+		return (false);
+	std::memcpy(&chunk, state.data() + head, sizeof(chunk));
+	if (std::memcmp(chunk.tag, "META", 4) == 0)
+		head += SAVESTATE_HEADER_SIZE + chunk.size;
+	packed.resize(state.remaining());
+	raw.resize(head + pack.raw);
+	if (packed.empty() || state.read(&packed[0], packed.size()) == false
+		|| unpack(static_cast<Codec>(pack.codec), &packed[0], packed.size(),
+			&raw[head], pack.raw) == false)
+		return (false);
+	size = head - SAVESTATE_HEADER_SIZE + pack.raw;
+	std::memcpy(&raw[0], state.data(), head);
+	std::memcpy(&raw[8], &size, 4);
+	return (state.assign(&raw[0], raw.size()));
+}
+
+size_t Gbmu::StateCodec::saveBatch (Job *jobs, size_t const& count, ThreadPool& pool)
+{
+	size_t		failed = 0;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		jobs[i].ok = false;
+		pool.run(std::bind(saveJob, jobs + i));
+	}
+	pool.wait();
+	for (size_t i = 0; i < count; i++)
+		failed += jobs[i].ok == false;
+	return (failed);
+}
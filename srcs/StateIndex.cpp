@@ -0,0 +1,166 @@
+#include "../includes/StateIndex.class.hpp"
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <cctype>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+Gbmu::StateIndex::StateIndex (void) :
+	_entries(NULL),
+	_count(0),
+	_mapped(0)
+{}
+
+Gbmu::StateIndex::~StateIndex (void)
+{
+	this->close();
+}
+
+/*
+** Title, time and a 4 x 4 box filtered thumbnail of the last frame
+*/
+void Gbmu::StateIndex::describe (Info& info, std::string const& title, uint16_t const& checksum,
+	uint64_t const& frames, uint32_t const* pixels)
+{
+	uint32_t	sum[4];
+	uint32_t	color;
+
+	std::memset(&info, 0, sizeof(info));
+	std::strncpy(info.title, title.c_str(), sizeof(info.title) - 1);
+	info.checksum = checksum;
+	info.time = std::time(NULL);
+	info.frames = frames;
+	for (int y = 0; y < STATE_THUMB_HEIGHT; y++)
+		for (int x = 0; x < STATE_THUMB_WIDTH; x++)
+		{
+			std::memset(sum, 0, sizeof(sum));
+			for (int dy = 0; dy < 4; dy++)
+				for (int dx = 0; dx < 4; dx++)
+				{
+					color = pixels[(y * 4 + dy) * SCREEN_WIDTH + x * 4 + dx];
+					for (int c = 0; c < 4; c++)
+						sum[c] += (color >> (c * 8)) & 0xFF;
+				}
+			color = 0;
+			for (int c = 0; c < 4; c++)
+				color |= (sum[c] / 16) << (c * 8);
+			info.thumbnail[y * STATE_THUMB_WIDTH + x] = color;
+		}
+}
+
+void Gbmu::StateIndex::write (SaveState& state, Info const& info)
+{
+	state.begin("META", 1);
+	state.put(info);
+	state.end();
+}
+
+bool Gbmu::StateIndex::peek (std::string const& statePath, Info& info)
+{
+	uint8_t		header[STATE_INFO_OFFSET];
+	FILE*		file;
+	bool		ok;
+
+	if ((file = fopen(statePath.c_str(), "rb")) == NULL)
+		return (false);
+	ok = fread(header, 1, sizeof(header), file) == sizeof(header)
+		&& fread(&info, 1, sizeof(info), file) == sizeof(info);
+	fclose(file);
+	return (ok && std::memcmp(header, SAVESTATE_MAGIC, 4) == 0
+		&& std::memcmp(header + SAVESTATE_HEADER_SIZE, "META", 4) == 0);
+}
+
+/*
+** dir/TITLE-89b5.gbmi, next to the state
+*/
+std::string Gbmu::StateIndex::indexPath (std::string const& statePath, Info const& info)
+{
+	std::string		dir;
+	std::string		name;
+	size_t			slash = statePath.rfind('/');
+	char			checksum[8];
+
+	if (slash != std::string::npos)
+		dir = statePath.substr(0, slash + 1);
+	for (size_t i = 0; info.title[i] && i < sizeof(info.title); i++)
+		name += std::isalnum(static_cast<unsigned char>(info.title[i])) ? info.title[i] : '_';
+	std::snprintf(checksum, sizeof(checksum), "-%04x", info.checksum);
+	return (dir + name + checksum + STATE_INDEX_EXT);
+}
+
+/*
+** The entry of statePath is rewritten in place, or appended
+*/
+bool Gbmu::StateIndex::add (std::string const& indexPath, std::string const& statePath, Info const& info)
+{
+	Entry		entry;
+	char		path[STATE_PATH_SIZE];
+	off_t		offset = 0;
+	int			fd;
+	bool		ok;
+
+	if (statePath.size() >= STATE_PATH_SIZE)
+		return (false);
+	std::memset(&entry, 0, sizeof(entry.path));
+	std::strcpy(entry.path, statePath.c_str());
+	entry.info = info;
+	if ((fd = ::open(indexPath.c_str(), O_RDWR | O_CREAT, 0644)) < 0)
+		return (false);
+	while (pread(fd, path, sizeof(path), offset) == static_cast<ssize_t>(sizeof(path))
+			&& std::strncmp(path, entry.path, sizeof(path)) != 0)
+		offset += sizeof(Entry);		// stops on a torn last entry too, overwritten
+	ok = pwrite(fd, &entry, sizeof(entry), offset) == static_cast<ssize_t>(sizeof(entry));
+	return (::close(fd) == 0 && ok);
+}
+
+bool Gbmu::StateIndex::open (std::string const& indexPath)
+{
+	struct stat	st;
+	void*		map;
+	int			fd;
+
+	this->close();
+	if ((fd = ::open(indexPath.c_str(), O_RDONLY)) < 0)
+		return (false);
+	if (fstat(fd, &st) != 0 || st.st_size % sizeof(Entry) != 0)
+	{
+		::close(fd);
+		return (false);
+	}
+	if (st.st_size > 0)
+	{
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (map == MAP_FAILED)
+		{
+			::close(fd);
+			return (false);
+		}
+		_entries = static_cast<Entry const*>(map);
+		_mapped = st.st_size;
+		_count = st.st_size / sizeof(Entry);
+	}
+	::close(fd);
+	return (true);
+}
+
+void Gbmu::StateIndex::close (void)
+{
+	if (_entries)
+		munmap(const_cast<Entry*>(_entries), _mapped);
+	_entries = NULL;
+	_count = 0;
+	_mapped = 0;
+}
+
+size_t const& Gbmu::StateIndex::count (void) const
+{
+	return (_count);
+}
+
+Gbmu::StateIndex::Entry const& Gbmu::StateIndex::at (size_t const& i) const
+{
+	return (_entries[i]);
+}
@@ -0,0 +1,77 @@
+#include "../includes/ThreadPool.class.hpp"
+
+Gbmu::ThreadPool::ThreadPool (size_t const& threads) :
+	_busy(0),
+	_quit(false)
+{
+	size_t		count = threads ? threads : std::thread::hardware_concurrency();
+
+	if (count == 0)
+		count = 1;
+	for (size_t i = 0; i < count; i++)
+		_workers.push_back(std::thread(&ThreadPool::_loop, this));
+}
+
+Gbmu::ThreadPool::~ThreadPool (void)
+{
+	{
+		std::lock_guard<std::mutex>		guard(_lock);
+
+		_quit = true;
+	}
+	_ready.notify_all();
+	for (size_t i = 0; i < _workers.size(); i++)
+		_workers[i].join();
+}
+
+void Gbmu::ThreadPool::run (std::function<void()> const& task)
+{
+	{
+		std::lock_guard<std::mutex>		guard(_lock);
+
+		_tasks.push_back(task);
+	}
+	_ready.notify_one();
+}
+
+void Gbmu::ThreadPool::wait (void)
+{
+	std::unique_lock<std::mutex>	guard(_lock);
+
+	while (_tasks.empty() == false || _busy > 0)
+		_idle.wait(guard);
+}
+
+size_t Gbmu::ThreadPool::size (void) const
+{
+	return (_workers.size());
+}
+
+/*
+** Private
+*/
+
+/*
+** Worker: the queue is emptied before quitting
+*/
+void Gbmu::ThreadPool::_loop (void)
+{
+	std::unique_lock<std::mutex>	guard(_lock);
+	std::function<void()>			task;
+
+	while (true)
+	{
+		while (_tasks.empty() && _quit == false)
+			_ready.wait(guard);
+		if (_tasks.empty())
+			return ;
+		task = _tasks.front();
+		_tasks.pop_front();
+		_busy++;
+		guard.unlock();
+		task();
+		guard.lock();
+		_busy--;
+		_idle.notify_all();
+	}
+}
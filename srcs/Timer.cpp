@@ -0,0 +1,172 @@
+#include "../includes/Timer.class.hpp"
+#include "../includes/Interrupts.class.hpp"
+#include <new>
+
+/*
+** TIMA period in clock cycles for each TAC frequency ( bits 0-1 )
+*/
+static const uint16_t	g_periods[4] = { 1024, 16, 64, 256 };
+
+Gbmu::Timer::Timer (Cpu *cpu) :
+	_cpu(cpu),
+	_state(new (cpu->arena()->at<void>(ARENA_TIMER)) State)
+{
+	static_assert(sizeof(State) <= ARENA_PPU - ARENA_TIMER, "the timer overlaps the ppu");
+	this->reset();
+}
+
+Gbmu::Timer::~Timer (void) {}
+
+void Gbmu::Timer::reset (void)
+{
+	Scheduler*	scheduler = _cpu->scheduler();
+
+	_state->divBase = scheduler->now();
+	_state->lastSync = _state->divBase;
+	_state->tima = 0;
+	_state->tma = 0;
+	_state->tac = 0;
+	scheduler->setHandler(Scheduler::TIMER, &Gbmu::Timer::_onEvent, this);
+	scheduler->cancel(Scheduler::TIMER);
+}
+
+/*
+** Registers reads, computed from the clock
+*/
+uint8_t Gbmu::Timer::div (void) const
+{
+	return (this->_counter(_cpu->scheduler()->now()) >> 8);
+}
+
+uint8_t Gbmu::Timer::tima (void)
+{
+	this->_sync(_cpu->scheduler()->now());
+	return (_state->tima);
+}
+
+uint8_t Gbmu::Timer::tma (void) const
+{
+	return (_state->tma);
+}
+
+uint8_t Gbmu::Timer::tac (void) const
+{
+	return (0xF8 | _state->tac);
+}
+
+/*
+** Registers writes, the only moments the overflow event is recomputed
+*/
+void Gbmu::Timer::onWriteDIV (void)
+{
+	bool	high;
+
+	this->_sync(_cpu->scheduler()->now());
+	high = this->_signal();
+	_state->divBase = _state->lastSync;
+	if (high)						// the selected bit falls with the reset
+		this->_increment(1);
+	this->_schedule();
+}
+
+void Gbmu::Timer::onWriteTIMA (uint8_t const& value)
+{
+	this->_sync(_cpu->scheduler()->now());
+	_state->tima = value;
+	this->_schedule();
+}
+
+void Gbmu::Timer::onWriteTMA (uint8_t const& value)
+{
+	this->_sync(_cpu->scheduler()->now());
+	_state->tma = value;
+}
+
+void Gbmu::Timer::onWriteTAC (uint8_t const& value)
+{
+	bool	high;
+
+	this->_sync(_cpu->scheduler()->now());
+	high = this->_signal();
+	_state->tac = value & 0x07;
+	if (high && this->_signal() == false)	// disabling or switching bit can fall too
+		this->_increment(1);
+	this->_schedule();
+}
+
+/*
+** Private
+*/
+
+/*
+** Scheduler event: TIMA overflows now
+*/
+void Gbmu::Timer::_onEvent (void *owner, uint64_t const& when)
+{
+	Timer*	timer = static_cast<Timer*>(owner);
+
+	timer->_sync(when);
+	timer->_schedule();
+}
+
+uint16_t Gbmu::Timer::_counter (uint64_t const& when) const
+{
+	return (static_cast<uint16_t>(when - _state->divBase));
+}
+
+/*
+** Timer enabled AND selected DIV counter bit, TIMA counts the falling edges
+*/
+bool Gbmu::Timer::_signal (void) const
+{
+	return ((_state->tac & 0x04) && (this->_counter(_state->lastSync) & (g_periods[_state->tac & 0x03] >> 1)));
+}
+
+/*
+** Increment TIMA count times, reload TMA and request the interrupt on overflow
+*/
+void Gbmu::Timer::_increment (uint64_t const& count)
+{
+	uint64_t	left = count;
+
+	while (left)
+	{
+		if (_state->tima + left < 0x100)
+		{
+			_state->tima += left;
+			return ;
+		}
+		left -= 0x100 - _state->tima;
+		_state->tima = _state->tma;
+		_cpu->interrupts()->request(Interrupts::TIMER);
+	}
+}
+
+/*
+** Bring TIMA up to date at cycle when
+*/
+void Gbmu::Timer::_sync (uint64_t const& when)
+{
+	uint16_t	period = g_periods[_state->tac & 0x03];
+
+	if (_state->tac & 0x04)
+		this->_increment((when - _state->divBase) / period - (_state->lastSync - _state->divBase) / period);
+	_state->lastSync = when;
+}
+
+/*
+** Schedule the next overflow, ( 0x100 - TIMA ) periods after the last increment
+*/
+void Gbmu::Timer::_schedule (void)
+{
+	uint16_t	period = g_periods[_state->tac & 0x03];
+	uint64_t	ticks;
+
+	if ((_state->tac & 0x04) == 0)
+	{
+		_cpu->scheduler()->cancel(Scheduler::TIMER);
+		return ;
+	}
+	ticks = (_state->lastSync - _state->divBase) / period + (0x100 - _state->tima);
+	_cpu->scheduler()->schedule(Scheduler::TIMER, _state->divBase + ticks * period);
+}
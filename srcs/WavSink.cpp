@@ -0,0 +1,97 @@
+#include "../includes/WavSink.class.hpp"
+#include <cstring>
+
+/*
+** Little endian writes, whatever the host is
+*/
+static void		put16 (uint8_t *out, uint16_t const& value)
+{
+	out[0] = value & 0xFF;
+	out[1] = value >> 8;
+}
+
+static void		put32 (uint8_t *out, uint32_t const& value)
+{
+	put16(out, value & 0xFFFF);
+	put16(out + 2, value >> 16);
+}
+
+Gbmu::WavSink::WavSink (std::string const& path) :
+	_path(path),
+	_file(NULL),
+	_bytes(0)
+{}
+
+Gbmu::WavSink::~WavSink (void)
+{
+	this->close();
+}
+
+bool Gbmu::WavSink::open (unsigned int const& rate)
+{
+	this->close();
+	if ((_file = fopen(_path.c_str(), "wb")) == NULL)
+		return (false);
+	_bytes = 0;
+	this->_writeHeader(rate);
+	return (true);
+}
+
+void Gbmu::WavSink::write (AudioSample const* samples, size_t const& count)
+{
+	uint8_t		buffer[4];
+
+	if (_file == NULL)
+		return ;
+	for (size_t i = 0; i < count; i++)
+	{
+		put16(buffer, samples[i].left);
+		put16(buffer + 2, samples[i].right);
+		fwrite(buffer, 1, sizeof(buffer), _file);
+	}
+	_bytes += count * sizeof(buffer);
+}
+
+/*
+** Patch the RIFF and data sizes now that they are known
+*/
+void Gbmu::WavSink::close (void)
+{
+	uint8_t		size[4];
+
+	if (_file == NULL)
+		return ;
+	put32(size, 36 + _bytes);
+	fseek(_file, 4, SEEK_SET);
+	fwrite(size, 1, 4, _file);
+	put32(size, _bytes);
+	fseek(_file, 40, SEEK_SET);
+	fwrite(size, 1, 4, _file);
+	fclose(_file);
+	_file = NULL;
+}
+
+bool Gbmu::WavSink::realtime (void) const
+{
+	return (false);
+}
+
+/*
+** Private
+*/
+
+void Gbmu::WavSink::_writeHeader (unsigned int const& rate)
+{
+	uint8_t		header[44];
+
+	std::memcpy(header, "RIFF\0\0\0\0WAVEfmt ", 16);
+	put32(header + 16, 16);					// fmt chunk size
+	put16(header + 20, 1);					// PCM
+	put16(header + 22, 2);					// stereo
+	put32(header + 24, rate);
+	put32(header + 28, rate * sizeof(AudioSample));
+	put16(header + 32, sizeof(AudioSample));
+	put16(header + 34, 16);					// bits per sample
+	std::memcpy(header + 36, "data\0\0\0\0", 8);
+	fwrite(header, 1, sizeof(header), _file);
+}
@@ -1,32 +1,384 @@
 # include "../includes/Gbmu.class.hpp"
 # include "../includes/Registers.class.hpp"
+# include "../includes/Capture.class.hpp"
+# include "../includes/WavSink.class.hpp"
+# include "../includes/AlsaSink.class.hpp"
+# include "../includes/Lockstep.class.hpp"
+# include "../includes/Movie.class.hpp"
+# include "../includes/StateIndex.class.hpp"
 # include <iostream>
+# include <cstdlib>
+# include <ctime>
+# include <getopt.h>
 
-//int						main()
-int						main(int argc, char *argv[])
+static void				usage(void)
+{
+	std::cout << "usage: Gbmu [options] cartridge" << std::endl
+		<< "  -n, --frames N        run N frames without display (headless)" << std::endl
+		<< "  -p, --png LIST        write frames of LIST as PNG ( 1,60,100-120 )" << std::endl
+		<< "  -P, --png-prefix STR  PNG files prefix ( default: frame )" << std::endl
+		<< "  -r, --raw FILE        stream every frame as RGB24 ( - for stdout )" << std::endl
+		<< "  -y, --y4m FILE        stream every frame as Y4M ( - for stdout )" << std::endl
+		<< "  -t, --render-thread   render lines on a dedicated thread" << std::endl
+		<< "  -q, --queue N         capture queue depth in frames ( default: "
+		<< CAPTURE_DEPTH << " )" << std::endl
+		<< "  -l, --hash-log FILE   write the hash of every frame in FILE" << std::endl
+		<< "  -a, --audio OUT       play the sound on OUT: alsa, null or a .wav file" << std::endl
+		<< "  -S, --no-sound        never synthesize sound ( sound registers still behave )" << std::endl
+		<< "  -s, --speed X         headless speed, x1 is 59.73 fps ( default: 0, unlimited )" << std::endl
+		<< "  -m, --movie FILE      play the movie FILE headless, to its end without -n" << std::endl
+		<< "  -M, --record FILE     record the headless run as the movie FILE" << std::endl
+		<< "  -w, --save-state FILE save the state after the headless run ( and index it )" << std::endl
+		<< "  -z, --compress CODEC  compress the saved state: zlib, lz4 or zstd ( if built in )" << std::endl
+		<< "  -b, --boot-cache DIR  start at the boot point from the ROM cache in DIR" << std::endl
+		<< "                        ( recorded there by the first run )" << std::endl
+		<< "  -f, --boot-frame N    boot point: after N frames" << std::endl
+		<< "  -k, --boot-pc ADDR    boot point: the first time the pc is at ADDR ( hex )" << std::endl
+		<< "  -L, --lockstep N      step a reference cpu beside a copy run in silent," << std::endl
+		<< "                        threaded slices, compared every N instructions" << std::endl
+		<< "                        ( exit 1 at a divergence )" << std::endl
+		<< "usage: Gbmu --compare LOG_A LOG_B" << std::endl
+		<< "  report the first frame whose hash differs ( exit 0 if identical )" << std::endl
+		<< "usage: Gbmu --list INDEX" << std::endl
+		<< "  list the states of a ROM index ( .gbmi )" << std::endl
+		<< "usage: Gbmu --pack CODEC STATE..." << std::endl
+		<< "  recompress the state files in place, in parallel ( none unpacks them )" << std::endl;
+}
+
+/*
+** Audio sink named on the command line, NULL if unknown
+*/
+static Gbmu::IAudioSink*	createAudioSink(std::string const& name)
 {
+	if (name == "null")
+		return (new Gbmu::NullSink);
+	if (name == "alsa")
+		return (Gbmu::AlsaSink::available() ? new Gbmu::AlsaSink : NULL);
+	if (name.size() > 4 && name.compare(name.size() - 4, 4, ".wav") == 0)
+		return (new Gbmu::WavSink(name));
+	return (NULL);
+}
 
-	//Registers	reg;
-	//uint8_t 	t = 8;
-	//t = reg.getA();
-	//std::cout << reg;
-	//reg.setAF(0x1234);
-	//reg.setBC(0x1234);
-	//reg.setDE(0x1234);
-	//reg.setHL(0x1234);
-	//std::cout << reg;
+/*
+** Parse "1,60,100-120" and register each frame for PNG capture
+*/
+static bool				parsePngFrames(Gbmu::Capture& capture, std::string const& list)
+{
+	std::stringstream	ss(list);
+	std::string			item;
+	char*				end;
+	uint64_t			first, last;
+
+	while (std::getline(ss, item, ','))
+	{
+		first = std::strtoull(item.c_str(), &end, 10);
+		last = first;
+		if (*end == '-')
+			last = std::strtoull(end + 1, &end, 10);
+		if (*end != '\0' || item.empty() || last < first)
+			return (false);
+		for (uint64_t frame = first; frame <= last; frame++)
+			capture.addPngFrame(frame);
+	}
+	return (true);
+}
 
+/*
+** Lockstep run of frames ( or the movie ), the first divergence is reported
+*/
+static int				runLockstep(std::string const& path, size_t interval, long frames,
+							std::string const& moviePath)
+{
+	Gbmu::Lockstep		lockstep(interval);
+	Gbmu::Movie			movie;
+	Gbmu::Cartridge*	cartridge;
 
-	Gbmu::Gb			gb;
+	try
+	{
+		lockstep.load(path, Gbmu::Gb::Auto);
+	}
+	catch (std::exception& e)
+	{
+		std::perror("File opening failed");
+		return (1);
+	}
+	cartridge = lockstep.reference()->cartridge();
+	if (!moviePath.empty())
+	{
+		if (!movie.load(moviePath)
+			|| movie.romHash() != Gbmu::HashLog::hash(cartridge->data(), cartridge->size())
+			|| !lockstep.loadState(movie.state()))
+		{
+			std::cerr << "Cannot play the movie " << moviePath << " on this cartridge" << std::endl;
+			return (1);
+		}
+		movie.play();
+	}
+	for (long i = 0; frames > 0 ? i < frames : movie.mode() == Gbmu::Movie::PLAY; i++)
+	{
+		lockstep.setButtons(movie.input(0));
+		if (lockstep.runFrame() == false)
+		{
+			std::cout << lockstep.report();
+			return (1);
+		}
+	}
+	std::cout << "identical: " << std::dec << lockstep.instructions() << " instructions" << std::endl;
+	return (0);
+}
+
+/*
+** One line per state of the index, from the mapped entries only
+*/
+static int				listStates(std::string const& path)
+{
+	Gbmu::StateIndex	index;
+	char				date[32];
+	time_t				time;
+
+	if (index.open(path) == false)
+	{
+		std::cerr << "Invalid state index: " << path << std::endl;
+		return (1);
+	}
+	for (size_t i = 0; i < index.count(); i++)
+	{
+		Gbmu::StateIndex::Entry const&	entry = index.at(i);
+
+		time = entry.info.time;
+		std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", std::localtime(&time));
+		std::cout << entry.path << "  " << entry.info.title << "  " << date
+			<< "  frame " << std::dec << entry.info.frames << std::endl;
+	}
+	return (0);
+}
+
+/*
+** Every state is read first, then all of them are written at once by a pool
+*/
+static int				packStates(Gbmu::StateCodec::Codec const& codec, char **paths, size_t count)
+{
+	std::vector<Gbmu::SaveState*>		states(count);
+	std::vector<Gbmu::StateCodec::Job>	jobs(count);
+	Gbmu::ThreadPool					pool(0);
+	size_t								failed;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		states[i] = new Gbmu::SaveState;
+		if (Gbmu::StateCodec::load(*states[i], paths[i]) == false)
+		{
+			std::cerr << "Cannot read the state " << paths[i] << std::endl;
+			for (size_t j = 0; j <= i; j++)
+				delete states[j];
+			return (1);
+		}
+		jobs[i].state = states[i];
+		jobs[i].path = paths[i];
+		jobs[i].codec = codec;
+		jobs[i].level = 0;
+	}
+	failed = Gbmu::StateCodec::saveBatch(&jobs[0], count, pool);
+	for (size_t i = 0; i < count; i++)
+	{
+		if (jobs[i].ok == false)
+			std::cerr << "Cannot write the state " << jobs[i].path << std::endl;
+		delete states[i];
+	}
+	return (failed ? 1 : 0);
+}
+
+//int						main()
+int						main(int argc, char *argv[])
+{
+	static struct option	options[] = {
+		{"frames", required_argument, NULL, 'n'},
+		{"png", required_argument, NULL, 'p'},
+		{"png-prefix", required_argument, NULL, 'P'},
+		{"raw", required_argument, NULL, 'r'},
+		{"y4m", required_argument, NULL, 'y'},
+		{"render-thread", no_argument, NULL, 't'},
+		{"queue", required_argument, NULL, 'q'},
+		{"hash-log", required_argument, NULL, 'l'},
+		{"audio", required_argument, NULL, 'a'},
+		{"no-sound", no_argument, NULL, 'S'},
+		{"speed", required_argument, NULL, 's'},
+		{"movie", required_argument, NULL, 'm'},
+		{"record", required_argument, NULL, 'M'},
+		{"lockstep", required_argument, NULL, 'L'},
+		{"save-state", required_argument, NULL, 'w'},
+		{"compress", required_argument, NULL, 'z'},
+		{"boot-cache", required_argument, NULL, 'b'},
+		{"boot-frame", required_argument, NULL, 'f'},
+		{"boot-pc", required_argument, NULL, 'k'},
+		{"compare", no_argument, NULL, 'c'},
+		{"list", no_argument, NULL, 'i'},
+		{"pack", required_argument, NULL, 'x'},
+		{NULL, 0, NULL, 0}
+	};
 	std::string 		path;
+	long				frames = 0;
+	bool				renderThread = false;
+	std::string			pngList, pngPrefix, stream;
+	Gbmu::Capture::Format	format = Gbmu::Capture::NONE;
+	size_t				depth = CAPTURE_DEPTH;
+	std::string			hashLogPath;
+	std::string			audio;
+	Gbmu::IAudioSink*	audioSink = NULL;
+	bool				sound = true;
+	double				speed = 0;
+	std::string			moviePath, recordPath;
+	bool				compare = false;
+	bool				list = false;
+	bool				pack = false;
+	std::string			statePath;
+	Gbmu::StateCodec::Codec	codec = Gbmu::StateCodec::NONE;
+	std::string			bootCache;
+	Gbmu::BootCache::Trigger	bootTrigger = Gbmu::BootCache::FRAME;
+	long				bootAt = -1;
+	long				lockstep = 0;
+	int					opt;
 
-	if (argc != 2)
+	while ((opt = getopt_long(argc, argv, "n:p:P:r:y:tq:l:a:Ss:m:M:L:w:z:b:f:k:cix:", options, NULL)) != -1)
+	{
+		switch (opt)
+		{
+			case 'n': frames = std::atol(optarg); break;
+			case 'p': pngList = optarg; break;
+			case 'P': pngPrefix = optarg; break;
+			case 'r': stream = optarg; format = Gbmu::Capture::RAW; break;
+			case 'y': stream = optarg; format = Gbmu::Capture::Y4M; break;
+			case 't': renderThread = true; break;
+			case 'q': depth = std::max(1L, std::atol(optarg)); break;
+			case 'l': hashLogPath = optarg; break;
+			case 'a': audio = optarg; break;
+			case 'S': sound = false; break;
+			case 's': speed = std::atof(optarg); break;
+			case 'm': moviePath = optarg; break;
+			case 'M': recordPath = optarg; break;
+			case 'L': lockstep = std::max(1L, std::atol(optarg)); break;
+			case 'w': statePath = optarg; break;
+			case 'z':
+				if (Gbmu::StateCodec::parse(optarg, codec) == false)
+				{
+					usage();
+					return (1);
+				}
+				break;
+			case 'b': bootCache = optarg; break;
+			case 'f': bootTrigger = Gbmu::BootCache::FRAME; bootAt = std::max(0L, std::atol(optarg)); break;
+			case 'k': bootTrigger = Gbmu::BootCache::PC; bootAt = std::strtol(optarg, NULL, 16) & 0xFFFF; break;
+			case 'c': compare = true; break;
+			case 'i': list = true; break;
+			case 'x':
+				if (Gbmu::StateCodec::parse(optarg, codec) == false)
+				{
+					usage();
+					return (1);
+				}
+				pack = true;
+				break;
+			default: usage(); return (1);
+		}
+	}
+	if (compare)
+	{
+		if (argc - optind != 2)
+		{
+			usage();
+			return (2);
+		}
+		return (Gbmu::HashLog::compare(argv[optind], argv[optind + 1]));
+	}
+	if (list)
+	{
+		if (argc - optind != 1)
+		{
+			usage();
+			return (2);
+		}
+		return (listStates(argv[optind]));
+	}
+	if (pack)
+	{
+		if (argc - optind < 1)
+		{
+			usage();
+			return (2);
+		}
+		if (Gbmu::StateCodec::available(codec) == false)
+		{
+			std::cerr << Gbmu::StateCodec::name(codec) << " is not built in" << std::endl;
+			return (1);
+		}
+		return (packStates(codec, argv + optind, argc - optind));
+	}
+	if (argc - optind != 1)
 	{
 		std::cout << "Gbmu Should take a cartridge as parameter and can't take more than 1 cartridge" << std::endl;
+		usage();
 		return(0);
 	}
-	path = argv[1];
-		
+	path = argv[optind];
+	if (Gbmu::StateCodec::available(codec) == false)
+	{
+		std::cerr << Gbmu::StateCodec::name(codec) << " is not built in" << std::endl;
+		return (1);
+	}
+	if (!moviePath.empty() && !recordPath.empty())
+	{
+		std::cerr << "--movie and --record are exclusive" << std::endl;
+		return (1);
+	}
+	if (!bootCache.empty() && bootAt < 0)
+	{
+		std::cerr << "--boot-cache needs --boot-frame or --boot-pc" << std::endl;
+		return (1);
+	}
+	if (lockstep > 0)
+		return (runLockstep(path, lockstep, frames, moviePath));
+	if (!sound && !audio.empty())
+	{
+		std::cerr << "--audio needs sound" << std::endl;
+		return (1);
+	}
+
+	Gbmu::Gb			gb(sound);
+
+	Gbmu::Capture		capture(depth);
+	Gbmu::HashLog		hashLog;
+
+	if (!pngList.empty() && parsePngFrames(capture, pngList) == false)
+	{
+		std::cerr << "Invalid PNG frame list: " << pngList << std::endl;
+		return (1);
+	}
+	if (!pngPrefix.empty())
+		capture.setPngPrefix(pngPrefix);
+	if (format != Gbmu::Capture::NONE && capture.openStream(stream, format) == false)
+	{
+		std::perror(stream.c_str());
+		return (1);
+	}
+
+	if (!hashLogPath.empty() && hashLog.open(hashLogPath) == false)
+	{
+		std::perror(hashLogPath.c_str());
+		return (1);
+	}
+
+	if (!audio.empty() && (audioSink = createAudioSink(audio)) == NULL)
+	{
+		std::cerr << "Invalid or unavailable audio output: " << audio << std::endl;
+		return (1);
+	}
+	if (audioSink && gb.setAudioSink(audioSink) == false)
+	{
+		std::cerr << "Cannot open audio output: " << audio << std::endl;
+		delete audioSink;
+		return (1);
+	}
+
 	try
 	{
 		gb.load(path);
@@ -34,7 +386,52 @@ int						main(int argc, char *argv[])
 	catch (std::exception& e)
 	{
 		std::perror("File opening failed");
+		return (1);
+	}
+
+	// Headless run
+	if (!bootCache.empty() && gb.boot(bootCache, bootTrigger, bootAt) == false)
+	{
+		std::cerr << "The boot point was not reached or not cached in " << bootCache << std::endl;
+		return (1);
+	}
+	if (!moviePath.empty() && gb.playMovie(moviePath) == false)
+	{
+		std::cerr << "Cannot play the movie " << moviePath << " on this cartridge" << std::endl;
+		return (1);
+	}
+	if (frames > 0 || !moviePath.empty())
+	{
+		capture.start();
+		gb.setScreen(&capture);
+		if (!hashLogPath.empty())
+			gb.setHashLog(&hashLog);
+		gb.setRenderThread(renderThread);
+		gb.setSpeed(speed);
+		if (!recordPath.empty())
+			gb.recordMovie(recordPath);
+		for (long i = 0; frames > 0 ? i < frames : gb.status().movie; i++)
+			gb.runFrame();
+		if (!recordPath.empty() && gb.stopMovie() == false)
+			std::perror(recordPath.c_str());
+		if (!statePath.empty() && gb.saveState(statePath, codec) == false)
+			std::perror(statePath.c_str());
+		if (speed > 0)
+		{
+			double	fps, jitterMean, jitterMax;
+
+			gb.pacing(fps, jitterMean, jitterMax);
+			std::cerr << "pacing: " << fps << " fps, jitter " << jitterMean
+				<< " us mean, " << jitterMax << " us max" << std::endl;
+		}
+		gb.setRenderThread(false);	// every frame reached the capture
+		gb.setScreen(NULL);
+		gb.setHashLog(NULL);
+		capture.stop();
+		hashLog.close();
 	}
+	gb.setAudioSink(NULL);
+	delete audioSink;
 
 	return(0);
 }
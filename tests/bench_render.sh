@@ -0,0 +1,34 @@
+#!/bin/bash
+#
+# Inline vs threaded rendering: wall time of a headless run of each ROM,
+# the frame hashes of both modes must match.
+#
+#	tests/bench_render.sh [FRAMES] [ROM..]		( make bench )
+#
+# The render thread only pays off with a second core: on a single core
+# both modes cost the same, the threaded one a few wake ups per frame more.
+
+GBMU=${GBMU:-./Gbmu}
+FRAMES=${1:-3000}
+shift
+ROMS=("$@")
+[ ${#ROMS[@]} -eq 0 ] && ROMS=("roms/Tetris.gb" "roms/Pokemon - Version Or.gbc")
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+TIMEFORMAT=%R
+status=0
+
+echo "$(nproc) core(s), $FRAMES frames"
+for rom in "${ROMS[@]}"; do
+	inline=$( { time "$GBMU" -S -n "$FRAMES" -l "$TMP/inline.log" "$rom" >/dev/null 2>&1; } 2>&1 )
+	threaded=$( { time "$GBMU" -S -t -n "$FRAMES" -l "$TMP/threaded.log" "$rom" >/dev/null 2>&1; } 2>&1 )
+	if cmp -s "$TMP/inline.log" "$TMP/threaded.log"; then
+		same="same pixels"
+	else
+		same="PIXELS DIFFER"
+		status=1
+	fi
+	printf "%-32s inline %6.2f s  threaded %6.2f s  x%.2f  %s\n" "$(basename "$rom")" \
+		"$inline" "$threaded" "$(awk "BEGIN { print $inline / $threaded }")" "$same"
+done
+exit $status
@@ -0,0 +1,158 @@
+#!/bin/bash
+#
+# Hash checks and round trips of headless runs, one line per check and ROM,
+# exit 1 if any of them failed.
+#
+#	tests/check.sh [ROM..]		( make check )
+#
+# A check passes when its commands succeed, the hash logs it compares match.
+
+GBMU=${GBMU:-./Gbmu}
+STATES=${STATES:-tests/check_states}
+FRAMES=${FRAMES:-600}
+ROMS=("$@")
+[ ${#ROMS[@]} -eq 0 ] && ROMS=("roms/Tetris.gb" "roms/Pokemon - Version Or.gbc")
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+status=0
+
+# headless run of rom, its output dropped
+run ()
+{
+	"$GBMU" "$@" >/dev/null 2>&1
+}
+
+# inline and threaded rendering draw the same frames
+check_render ()
+{
+	run -S -n "$FRAMES" -l "$TMP/inline.log" "$1" \
+		&& run -S -t -n "$FRAMES" -l "$TMP/threaded.log" "$1" \
+		&& cmp -s "$TMP/inline.log" "$TMP/threaded.log"
+}
+
+# a state saved to a file and loaded by another Gb runs on the same way
+check_save ()
+{
+	"$STATES" save "$1" "$TMP" >/dev/null 2>&1
+}
+
+# back to a snapshot the next frames are the same again
+check_snapshot ()
+{
+	"$STATES" snapshot "$1" "$TMP" >/dev/null 2>&1
+}
+
+# each rewind is the state of the capture before, byte for byte
+check_rewind ()
+{
+	"$STATES" rewind "$1" "$TMP" >/dev/null 2>&1
+}
+
+# a recorded movie plays back the frames of its recording
+check_movie ()
+{
+	run -S -n "$FRAMES" -M "$TMP/movie.gbm" -l "$TMP/record.log" "$1" \
+		&& run -S -m "$TMP/movie.gbm" -l "$TMP/play.log" "$1" \
+		&& run -S -t -m "$TMP/movie.gbm" -l "$TMP/threaded.log" "$1" \
+		&& cmp -s "$TMP/record.log" "$TMP/play.log" \
+		&& cmp -s "$TMP/record.log" "$TMP/threaded.log"
+}
+
+# a stepped cpu and one run in threaded, silent slices never diverge
+check_lockstep ()
+{
+	run -S -L 1000 -n 300 "$1"
+}
+
+# forked branches run on their own from the state of the Gb
+check_fork ()
+{
+	"$STATES" fork "$1" "$TMP" >/dev/null 2>&1
+}
+
+# states packed in a batch by each codec built in and unpacked are unchanged
+check_codec ()
+{
+	local codec
+
+	run -S -n "$FRAMES" -w "$TMP/state.gbms" "$1" || return 1
+	for codec in zlib lz4 zstd; do
+		"$GBMU" --pack "$codec" "$TMP/missing" 2>&1 | grep -q "not built in" && continue
+		cp "$TMP/state.gbms" "$TMP/a.gbms"
+		cp "$TMP/state.gbms" "$TMP/b.gbms"
+		run --pack "$codec" "$TMP/a.gbms" "$TMP/b.gbms" \
+			&& ! cmp -s "$TMP/a.gbms" "$TMP/state.gbms" \
+			&& run --pack none "$TMP/a.gbms" "$TMP/b.gbms" \
+			&& cmp -s "$TMP/a.gbms" "$TMP/state.gbms" \
+			&& cmp -s "$TMP/b.gbms" "$TMP/state.gbms" || return 1
+	done
+}
+
+# a boot cache hit runs on like the miss that recorded it, without
+# writing the file again ( same inode ); a stale key is recorded again
+check_boot ()
+{
+	local file inode
+
+	mkdir "$TMP/cache"
+	run -S -b "$TMP/cache" -f 120 -n 300 -l "$TMP/miss.log" "$1" || return 1
+	file=$(ls "$TMP"/cache/*.gbmb) && inode=$(stat -c %i "$file") || return 1
+	run -S -b "$TMP/cache" -f 120 -n 300 -l "$TMP/hit.log" "$1" \
+		&& cmp -s "$TMP/miss.log" "$TMP/hit.log" \
+		&& [ "$(stat -c %i "$file")" = "$inode" ] || return 1
+	printf '\xff' | dd of="$file" bs=1 seek=27 conv=notrunc 2>/dev/null	# ROM size code
+	run -S -b "$TMP/cache" -f 120 -n 300 -l "$TMP/stale.log" "$1" \
+		&& cmp -s "$TMP/miss.log" "$TMP/stale.log" \
+		&& [ "$(stat -c %i "$file")" != "$inode" ]
+}
+
+# --compare finds identical logs and the first frame that differs
+check_compare ()
+{
+	run -S -n "$FRAMES" -l "$TMP/a.log" "$1" || return 1
+	cp "$TMP/a.log" "$TMP/b.log"
+	"$GBMU" --compare "$TMP/a.log" "$TMP/b.log" >/dev/null 2>&1 || return 1
+	printf '\x5a' | dd of="$TMP/b.log" bs=1 seek=$((8 + 8 * 99)) conv=notrunc 2>/dev/null
+	! "$GBMU" --compare "$TMP/a.log" "$TMP/b.log" >"$TMP/compare.txt" 2>&1 \
+		&& grep -q "frame 100:" "$TMP/compare.txt"
+}
+
+# a wav streamed inline or with the render thread, nothing dropped
+check_sound ()
+{
+	run -n "$FRAMES" -a "$TMP/inline.wav" "$1" \
+		&& run -t -n "$FRAMES" -a "$TMP/threaded.wav" "$1" \
+		&& [ "$(stat -c %s "$TMP/inline.wav")" -gt 44 ] \
+		&& cmp -s "$TMP/inline.wav" "$TMP/threaded.wav"
+}
+
+# without sound ( -S ) the frames are the same as with it
+check_silent ()
+{
+	run -n "$FRAMES" -a null -l "$TMP/sound.log" "$1" \
+		&& run -S -n "$FRAMES" -l "$TMP/silent.log" "$1" \
+		&& cmp -s "$TMP/sound.log" "$TMP/silent.log"
+}
+
+# a saved state is listed in the index of its ROM with its frame
+check_index ()
+{
+	run -S -n 100 -w "$TMP/one.gbms" "$1" \
+		&& "$GBMU" --list "$TMP"/*.gbmi 2>/dev/null | grep -q "one.gbms .* frame 100$"
+}
+
+CHECKS=(render save snapshot rewind movie lockstep fork codec boot compare sound silent index)
+
+for rom in "${ROMS[@]}"; do
+	for check in "${CHECKS[@]}"; do
+		rm -rf "${TMP:?}"/*
+		if "check_$check" "$rom"; then
+			result="ok"
+		else
+			result="FAILED"
+			status=1
+		fi
+		printf "%-12s %-32s %s\n" "$check" "$(basename "$rom")" "$result"
+	done
+done
+exit $status
@@ -0,0 +1,157 @@
+#include "../includes/Gb.class.hpp"
+#include "../includes/Rewind.class.hpp"
+#include <iostream>
+#include <cstring>
+#include <vector>
+
+/*
+** Checks of the state API the command line does not reach, run by
+** tests/check.sh ( make check ):
+**
+**	tests/check_states CHECK ROM DIR	exit 1 if it failed, files go in DIR
+*/
+
+static bool		same (Gbmu::Snapshot const& a, Gbmu::Snapshot const& b)
+{
+	return (a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size()) == 0);
+}
+
+/*
+** A state saved to a file and loaded by another Gb runs on the same way
+*/
+static bool		checkSave (std::string const& rom, std::string const& dir)
+{
+	Gbmu::Gb		gb(false);
+	Gbmu::Gb		other(false);
+	Gbmu::Snapshot	a, b;
+	std::string		path = dir + "/save.gbms";
+
+	gb.load(rom);
+	other.load(rom);
+	gb.runFrames(100);
+	if (gb.saveState(path) == false || other.loadState(path) == false)
+		return (false);
+	gb.runFrames(50);
+	other.runFrames(50);
+	return (gb.snapshot(a) && other.snapshot(b) && same(a, b));
+}
+
+/*
+** Back to a snapshot, the next frames are the same again: inline, with
+** the render thread and with the emulation thread too
+*/
+static bool		checkSnapshot (std::string const& rom)
+{
+	for (int mode = 0; mode < 3; mode++)
+	{
+		Gbmu::Gb		gb(false);
+		Gbmu::Snapshot	start, a, b;
+
+		gb.load(rom);
+		gb.setRenderThread(mode > 0);
+		if (mode == 2)
+			gb.start();
+		gb.runFrames(100);
+		if (gb.snapshot(start) == false)
+			return (false);
+		gb.runFrames(50);
+		gb.snapshot(a);
+		if (gb.restore(start) == false)
+			return (false);
+		gb.runFrames(50);
+		gb.snapshot(b);
+		gb.stop();
+		if (same(a, b) == false)
+			return (false);
+	}
+	return (true);
+}
+
+/*
+** Each rewind gives back the state of the capture before, byte for byte,
+** in a ring large enough and in one that drops its oldest chains
+*/
+static bool		checkRewind (std::string const& rom)
+{
+	size_t const	memory[] = { REWIND_MEMORY, 12 << 10 };
+
+	for (size_t m = 0; m < 2; m++)
+	{
+		Gbmu::Gb					gb(false);
+		std::vector<Gbmu::Snapshot*>	kept;
+		Gbmu::Snapshot				now;
+		size_t						back = 0;
+		bool						ok = true;
+
+		gb.load(rom);
+		gb.setRewind(memory[m], 1);
+		for (size_t frame = 0; frame < 200; frame++)
+		{
+			gb.runFrame();
+			kept.push_back(new Gbmu::Snapshot);
+			gb.snapshot(*kept.back());
+		}
+		while (ok && gb.rewind())
+		{
+			back++;
+			ok = gb.snapshot(now) && same(now, *kept[kept.size() - 1 - back]);
+		}
+		for (size_t i = 0; i < kept.size(); i++)
+			delete kept[i];
+		if (ok == false || (m == 0 ? back != 199 : back < 8 || back == 199))
+			return (false);
+	}
+	return (true);
+}
+
+/*
+** Branches start where the Gb is and run on their own: one running ahead
+** first, the others and the Gb still end up on the same state
+*/
+static bool		checkFork (std::string const& rom)
+{
+	Gbmu::Gb				gb(false);
+	std::vector<Gbmu::Gb*>	branches;
+	Gbmu::Snapshot			a, b;
+	bool					ok;
+
+	gb.load(rom);
+	gb.runFrames(60);
+	branches = gb.fork(3);
+	ok = branches.size() == 3;
+	if (ok)
+	{
+		branches[0]->runFrames(300);
+		gb.runFrames(100);
+		ok = gb.snapshot(a);
+		for (size_t i = 1; i < branches.size(); i++)
+		{
+			branches[i]->runFrames(100);
+			ok = ok && branches[i]->snapshot(b) && same(a, b);
+		}
+	}
+	for (size_t i = 0; i < branches.size(); i++)
+		delete branches[i];
+	return (ok);
+}
+
+int				main (int ac, char **av)
+{
+	std::string		check = ac > 3 ? av[1] : "";
+	bool			ok;
+
+	if (check == "save")
+		ok = checkSave(av[2], av[3]);
+	else if (check == "snapshot")
+		ok = checkSnapshot(av[2]);
+	else if (check == "rewind")
+		ok = checkRewind(av[2]);
+	else if (check == "fork")
+		ok = checkFork(av[2]);
+	else
+	{
+		std::cerr << "usage: check_states save | snapshot | rewind | fork ROM DIR" << std::endl;
+		return (2);
+	}
+	return (ok ? 0 : 1);
+}